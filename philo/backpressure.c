@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   backpressure.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 22:31:09 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 22:31:09 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "philosophers.h"
+#include <errno.h>
+#include <fcntl.h>
+
+/**
+ * @brief Writes a whole chunk, however many writes it takes.
+ *
+ * A slow or blocked stdout may take only part of a chunk per write.
+ *
+ * @param fd The file descriptor to write to.
+ * @param buffer The chunk.
+ * @param length The size of the chunk in bytes.
+ * @return ssize_t The size of the chunk, or -1 if a write failed.
+ */
+static ssize_t	write_chunk(int fd, char *buffer, ssize_t length)
+{
+	ssize_t	written;
+	ssize_t	total;
+
+	total = 0;
+	while (total < length)
+	{
+		written = write(fd, buffer + total, length - total);
+		if (written < 0 && errno != EINTR)
+			return (-1);
+		if (written > 0)
+			total += written;
+	}
+	return (total);
+}
+
+/**
+ * @brief Drains the stdout pipe at the rate of `--backpressure KB`.
+ *
+ * Every chunk read from the pipe is written to the real stdout, then the
+ * reader sleeps for as long as the chunk takes at KB KiB/s. Once the pipe is
+ * full, the philosopher printing an event blocks with the party's dying
+ * mutex held, as it would on a slow terminal or a stalled log collector.
+ *
+ * @param party_data A pointer to the t_party struct representing the party.
+ * @return void* Always NULL, once the pipe is closed and drained.
+ */
+static void	*reader_routine(void *party_data)
+{
+	t_party	*party;
+	char	buffer[BACKPRESSURE_CHUNK];
+	ssize_t	length;
+
+	party = (t_party *)party_data;
+	length = read(party->disturbance.pipe_out, buffer, sizeof(buffer));
+	while (length > 0)
+	{
+		length = write_chunk(party->disturbance.saved_stdout, buffer, length);
+		if (length > 0)
+			usleep(length * 1000000ULL
+				/ (party->options.backpressure * 1024ULL));
+		length = read(party->disturbance.pipe_out, buffer, sizeof(buffer));
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Routes stdout through a slow pipe.
+ *
+ * The pipe is shrunk to a single page, so that backpressure starts after a
+ * few dozen events, and stdout is made line buffered so that every event
+ * reaches the pipe when it is printed. The real stdout is kept for the
+ * reader thread.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return t_return_value SUCCESS, ERROR or THREAD_FAIL
+ */
+t_return_value	start_backpressure(t_party *party)
+{
+	int	pipe_ends[2];
+
+	fflush(stdout);
+	setvbuf(stdout, NULL, _IOLBF, 0);
+	if (pipe(pipe_ends) != 0)
+	{
+		printf("Failed to open the backpressure pipe\n");
+		return (ERROR);
+	}
+	fcntl(pipe_ends[1], F_SETPIPE_SZ, BACKPRESSURE_CHUNK);
+	party->disturbance.pipe_out = pipe_ends[0];
+	party->disturbance.saved_stdout = dup(STDOUT_FILENO);
+	if (pthread_create(&(party->disturbance.reader), NULL, reader_routine,
+			party) != 0)
+	{
+		close(pipe_ends[0]);
+		close(pipe_ends[1]);
+		close(party->disturbance.saved_stdout);
+		party->disturbance.saved_stdout = -1;
+		printf("Failed to create the backpressure reader\n");
+		return (THREAD_FAIL);
+	}
+	dup2(pipe_ends[1], STDOUT_FILENO);
+	close(pipe_ends[1]);
+	return (SUCCESS);
+}
+
+/**
+ * @brief Gives stdout back and waits for the pipe to be drained.
+ *
+ * Restoring stdout closes the last write end of the pipe, so the reader
+ * prints what is left and returns. Does nothing if stdout was not routed.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ */
+void	stop_backpressure(t_party *party)
+{
+	if (party->disturbance.saved_stdout < 0)
+		return ;
+	fflush(stdout);
+	dup2(party->disturbance.saved_stdout, STDOUT_FILENO);
+	pthread_join(party->disturbance.reader, NULL);
+	close(party->disturbance.pipe_out);
+	close(party->disturbance.saved_stdout);
+	party->disturbance.saved_stdout = -1;
+}
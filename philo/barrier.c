@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   barrier.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:02:27 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 15:02:27 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Initializes a reusable barrier.
+ *
+ * pthread_barrier_t is optional in POSIX and missing on macOS, hence this 
+ * small mutex and condition variable based barrier.
+ *
+ * @param barrier A pointer to the t_barrier struct to initialize.
+ * @param parties The number of threads meeting at the barrier.
+ * @return t_return_value SUCCESS or MUTEX_FAIL
+ */
+t_return_value	barrier_init(t_barrier *barrier, unsigned int parties)
+{
+	barrier->parties = parties;
+	barrier->arrived = 0;
+	barrier->generation = 0;
+	if (pthread_mutex_init(&(barrier->lock), NULL) != SUCCESS)
+		return (MUTEX_FAIL);
+	if (pthread_cond_init(&(barrier->all_arrived), NULL) != SUCCESS)
+	{
+		pthread_mutex_destroy(&(barrier->lock));
+		return (MUTEX_FAIL);
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @brief Waits until all the parties of the barrier have arrived.
+ *
+ * The generation counter makes the barrier reusable right away: a thread 
+ * released from one round cannot be mistaken for an arrival of the next.
+ *
+ * @param barrier A pointer to the t_barrier struct.
+ */
+void	barrier_wait(t_barrier *barrier)
+{
+	unsigned long long	generation;
+
+	pthread_mutex_lock(&(barrier->lock));
+	generation = barrier->generation;
+	barrier->arrived++;
+	if (barrier->arrived == barrier->parties)
+	{
+		barrier->arrived = 0;
+		barrier->generation++;
+		pthread_cond_broadcast(&(barrier->all_arrived));
+	}
+	while (generation == barrier->generation)
+		pthread_cond_wait(&(barrier->all_arrived), &(barrier->lock));
+	pthread_mutex_unlock(&(barrier->lock));
+}
+
+/**
+ * @brief Destroys a barrier nobody is waiting on.
+ *
+ * @param barrier A pointer to the t_barrier struct.
+ */
+void	barrier_destroy(t_barrier *barrier)
+{
+	pthread_mutex_destroy(&(barrier->lock));
+	pthread_cond_destroy(&(barrier->all_arrived));
+}
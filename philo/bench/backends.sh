@@ -0,0 +1,48 @@
+#!/bin/bash
+# **************************************************************************** #
+#                                                                              #
+#    backends.sh - thread backend against the --processes backend              #
+#                                                                              #
+#    Usage: bench/backends.sh                                                  #
+#    Environment: SEATS (list), EAT, SLEEP, MEALS                              #
+#                                                                              #
+#    For each table size, prints the meals per second and the memory           #
+#    footprint of a surviving table of MEALS meals, and the death detection    #
+#    lag of a table starving at 150 ms, with threads and with processes.       #
+#    The footprint is the proportional set size, summed over the processes,    #
+#    so the pages they share are counted once as with threads.                 #
+#                                                                              #
+# **************************************************************************** #
+
+PHILO=${PHILO:-./philo}
+SEATS=${SEATS:-"2 5 50 100 200 300"}
+EAT=${EAT:-20}
+SLEEP=${SLEEP:-20}
+MEALS=${MEALS:-20}
+
+field()
+{
+	sed -n "s/.*$1 \([0-9.]*\).*/\1/p" | head -1
+}
+
+survive()
+{
+	"$PHILO" --stats "$@" 10000 "$EAT" "$SLEEP" "$MEALS" 2>&1 >/dev/null
+}
+
+starve()
+{
+	"$PHILO" --stats "$@" 150 200 100 2>&1 >/dev/null | field "death lag"
+}
+
+printf "seats\tbackend\t\tmeals/s\t\tpss KiB\tdeath lag ms\n"
+for seats in $SEATS; do
+	report=$(survive "$seats")
+	printf "%s\tthreads\t\t%s\t\t%s\t%s\n" "$seats" \
+		"$(echo "$report" | field "meals\/s")" \
+		"$(echo "$report" | field "pss")" "$(starve "$seats")"
+	report=$(survive --processes "$seats")
+	printf "%s\tprocesses\t%s\t\t%s\t%s\n" "$seats" \
+		"$(echo "$report" | field "meals\/s")" \
+		"$(echo "$report" | field "pss")" "$(starve --processes "$seats")"
+done
@@ -0,0 +1,79 @@
+#!/bin/bash
+# **************************************************************************** #
+#                                                                              #
+#    jitter.sh - largest injected jitter each configuration survives          #
+#                                                                              #
+#    Usage: bench/jitter.sh ["philo options"...]                               #
+#    Environment: SEATS, DIE, EAT, SLEEP, MEALS, RUNS                          #
+#                                                                              #
+#    For each configuration (one quoted set of philo options), binary         #
+#    searches the largest --jitter (ms) for which RUNS consecutive runs of    #
+#    MEALS meals end without a death, and prints the smallest slack left at   #
+#    that jitter: a "survives with X ms of jitter" figure per configuration.  #
+#                                                                              #
+# **************************************************************************** #
+
+PHILO=${PHILO:-./philo}
+SEATS=${SEATS:-5}
+DIE=${DIE:-800}
+EAT=${EAT:-200}
+SLEEP=${SLEEP:-200}
+MEALS=${MEALS:-10}
+RUNS=${RUNS:-3}
+
+if [ $# -eq 0 ]; then
+	set -- "" "--edf" "--adaptive-think" "--burners $(nproc)" \
+		"--backpressure 64"
+fi
+
+jitter_option()
+{
+	if [ "$1" -gt 0 ]; then
+		echo "--jitter $1"
+	fi
+}
+
+# Prints the smallest slack (ms) of RUNS runs, or nothing if one died.
+min_slack()
+{
+	local config=$1 jitter=$2 run report slack lowest=""
+	for run in $(seq "$RUNS"); do
+		# shellcheck disable=SC2046,SC2086
+		report=$("$PHILO" --stats $config $(jitter_option "$jitter") \
+			"$SEATS" "$DIE" "$EAT" "$SLEEP" "$MEALS" 2>&1)
+		if echo "$report" | grep -q "died"; then
+			return 1
+		fi
+		slack=$(echo "$report" | sed -n "s/.*min slack \([-0-9.]*\).*/\1/p")
+		if [ -z "$lowest" ] || awk "BEGIN {exit !($slack < $lowest)}"; then
+			lowest=$slack
+		fi
+	done
+	echo "$lowest"
+}
+
+max_jitter()
+{
+	local config=$1 low=0 high=$DIE mid slack kept
+	if ! kept=$(min_slack "$config" 0); then
+		printf "dies without jitter\t-\n"
+		return
+	fi
+	while [ $((high - low)) -gt 1 ]; do
+		mid=$(((low + high) / 2))
+		if slack=$(min_slack "$config" "$mid"); then
+			low=$mid
+			kept=$slack
+		else
+			high=$mid
+		fi
+	done
+	printf "%s ms\t\t%s ms\n" "$low" "$kept"
+}
+
+printf "table %s %s %s %s %s, %s runs\n" "$SEATS" "$DIE" "$EAT" "$SLEEP" \
+	"$MEALS" "$RUNS"
+printf "configuration\t\tsurvives jitter\tmin slack\n"
+for config in "$@"; do
+	printf "%-20s\t%s\n" "${config:-baseline}" "$(max_jitter "$config")"
+done
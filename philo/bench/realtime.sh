@@ -0,0 +1,58 @@
+#!/bin/bash
+# **************************************************************************** #
+#                                                                              #
+#    realtime.sh - wakeup latency under a CPU hog, default against realtime   #
+#                                                                              #
+#    Usage: bench/realtime.sh                                                  #
+#    Environment: SEATS, HOGS (default: one per CPU), MEALS, CORE              #
+#                                                                              #
+#    Starts HOGS busy loops, then runs a surviving table of SEATS seats with  #
+#    --latency in the default mode and with --realtime --monitor-core CORE,   #
+#    and prints the p99.9 wakeup latency of the philosophers and of the       #
+#    monitor, and the death detection lag of a starving table.                #
+#    Without the privilege for SCHED_FIFO, philo warns and the realtime run   #
+#    measures the default policy.                                             #
+#                                                                              #
+# **************************************************************************** #
+
+PHILO=${PHILO:-./philo}
+SEATS=${SEATS:-50}
+HOGS=${HOGS:-$(nproc)}
+MEALS=${MEALS:-30}
+CORE=${CORE:-0}
+HOG_PIDS=()
+
+stop_hogs()
+{
+	kill "${HOG_PIDS[@]}" 2>/dev/null
+	wait "${HOG_PIDS[@]}" 2>/dev/null
+}
+trap stop_hogs EXIT
+
+field()
+{
+	sed -n "s/.*$1 \([0-9.]*\).*/\1/p" | head -1
+}
+
+measure()
+{
+	local report lag
+
+	report=$("$PHILO" --latency "$@" "$SEATS" 400 100 100 "$MEALS" \
+		2>&1 >/dev/null)
+	lag=$("$PHILO" --stats "$@" "$SEATS" 150 200 100 2>&1 >/dev/null \
+		| field "death lag")
+	printf "%s\t%s\t\t%s\t\t%s\n" "$1" \
+		"$(echo "$report" | grep philosophers | field "p99.9")" \
+		"$(echo "$report" | grep monitor | field "p99.9")" "$lag"
+	echo "$report" | grep warning >&2
+}
+
+for hog in $(seq "$HOGS"); do
+	( while :; do :; done ) &
+	HOG_PIDS+=($!)
+done
+printf "hogs %s\n" "$HOGS"
+printf "mode\t\tphilos p99.9 us\tmonitor p99.9 us\tdeath lag ms\n"
+measure --stats
+measure --realtime --monitor-core "$CORE"
@@ -0,0 +1,30 @@
+#!/bin/bash
+# **************************************************************************** #
+#                                                                              #
+#    segments.sh - table throughput per number of processes                    #
+#                                                                              #
+#    Usage: bench/segments.sh [philo options...]                               #
+#    Environment: SEATS, SEGMENTS (list), DIE, EAT, SLEEP, MEALS               #
+#                                                                              #
+#    Runs the same table split over each number of --segments processes and    #
+#    prints the meals per second of --stats next to the floor(N / 2) bound.    #
+#    One segment is the ordinary single-process table.                         #
+#                                                                              #
+# **************************************************************************** #
+
+PHILO=${PHILO:-./philo}
+SEATS=${SEATS:-200}
+SEGMENTS=${SEGMENTS:-"1 2 4 8"}
+DIE=${DIE:-100}
+EAT=${EAT:-10}
+SLEEP=${SLEEP:-10}
+MEALS=${MEALS:-50}
+
+printf "segments\tmeals/s\t\tbound\t\t(%s seats, %s %s %s, %s meals)\n" \
+	"$SEATS" "$DIE" "$EAT" "$SLEEP" "$MEALS"
+for segments in $SEGMENTS; do
+	"$PHILO" --stats --segments "$segments" "$@" \
+		"$SEATS" "$DIE" "$EAT" "$SLEEP" "$MEALS" 2>&1 >/dev/null \
+		| grep "^stats" | sed 's/.*meals\/s \([0-9.]*\).*bound \([0-9.]*\).*/\1\t\2/' \
+		| sed "s/^/$segments\t\t/"
+done
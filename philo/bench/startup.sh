@@ -0,0 +1,26 @@
+#!/bin/bash
+# **************************************************************************** #
+#                                                                              #
+#    startup.sh - thread startup cost per table size                           #
+#                                                                              #
+#    Usage: bench/startup.sh                                                   #
+#    Environment: SEATS (list)                                                 #
+#                                                                              #
+#    For each table size, runs a one-meal party with a generous time_to_die    #
+#    and prints the `startup` line of --stats, once with the default small     #
+#    stacks and tree spawn and once with 8 MiB stacks spawned serially.        #
+#                                                                              #
+# **************************************************************************** #
+
+PHILO=${PHILO:-./philo}
+SEATS=${SEATS:-"10 50 100 200 300"}
+
+startup()
+{
+	"$PHILO" --stats "$@" 100000 10 10 1 2>&1 >/dev/null | grep "^startup"
+}
+
+for seats in $SEATS; do
+	startup "$seats"
+	startup --serial-spawn --stack-size 8192 "$seats"
+done
@@ -0,0 +1,63 @@
+#!/bin/bash
+# **************************************************************************** #
+#                                                                              #
+#    survival.sh - smallest time_to_die each table size survives               #
+#                                                                              #
+#    Usage: bench/survival.sh [philo options...]                               #
+#    Environment: SEATS (list), EAT, SLEEP, MEALS, RUNS                        #
+#                                                                              #
+#    For each table size, binary searches the smallest time_to_die (ms) for    #
+#    which RUNS consecutive runs of MEALS meals end without a death, once      #
+#    without and once with the given philo options. The search starts from     #
+#    time_to_eat, which must die, and 4 * time_to_eat + time_to_sleep, which   #
+#    must survive; "no bracket" is printed when either bound does not hold.    #
+#                                                                              #
+# **************************************************************************** #
+
+PHILO=${PHILO:-./philo}
+SEATS=${SEATS:-"2 3 4 5 7 31 100 199"}
+EAT=${EAT:-60}
+SLEEP=${SLEEP:-60}
+MEALS=${MEALS:-15}
+RUNS=${RUNS:-3}
+
+survives()
+{
+	local run
+	for run in $(seq "$RUNS"); do
+		if "$PHILO" "$@" | grep -q "died"; then
+			return 1
+		fi
+	done
+	return 0
+}
+
+min_survivable()
+{
+	local seats=$1
+	shift
+	local low=$EAT
+	local high=$((EAT * 4 + SLEEP))
+	local mid
+	if survives "$@" "$seats" "$low" "$EAT" "$SLEEP" "$MEALS" \
+		|| ! survives "$@" "$seats" "$high" "$EAT" "$SLEEP" "$MEALS"; then
+		echo "no bracket"
+		return
+	fi
+	while [ $((high - low)) -gt 1 ]; do
+		mid=$(((low + high) / 2))
+		if survives "$@" "$seats" "$mid" "$EAT" "$SLEEP" "$MEALS"; then
+			high=$mid
+		else
+			low=$mid
+		fi
+	done
+	echo "$high"
+}
+
+printf "seats\tbaseline\t%s\t(time_to_eat %s, time_to_sleep %s)\n" \
+	"${*:-baseline}" "$EAT" "$SLEEP"
+for seats in $SEATS; do
+	printf "%s\t%s\t\t%s\n" "$seats" "$(min_survivable "$seats")" \
+		"$(min_survivable "$seats" "$@")"
+done
@@ -0,0 +1,36 @@
+#!/bin/bash
+# **************************************************************************** #
+#                                                                              #
+#    throughput.sh - meals per second against the floor(N / 2) bound          #
+#                                                                              #
+#    Usage: bench/throughput.sh [philo options...]                             #
+#    Environment: SEATS (list), DIE, EAT, SLEEP, MEALS                         #
+#                                                                              #
+#    Runs each table size with the greedy fork race and with --scheduled,      #
+#    and prints the meals per second of --stats next to the bound of           #
+#    floor(N / 2) eaters per time_to_eat, with the share of the bound that     #
+#    each mode reaches. Only meals finished within the party are counted.      #
+#                                                                              #
+# **************************************************************************** #
+
+PHILO=${PHILO:-./philo}
+SEATS=${SEATS:-"4 5 10 31 100 200"}
+DIE=${DIE:-800}
+EAT=${EAT:-20}
+SLEEP=${SLEEP:-20}
+MEALS=${MEALS:-50}
+
+rate() {
+	"$PHILO" --stats "$@" "$DIE" "$EAT" "$SLEEP" "$MEALS" 2>&1 >/dev/null \
+		| grep "^stats" | sed 's/.*meals\/s \([0-9.]*\).*bound \([0-9.]*\).*/\1 \2/'
+}
+
+printf "seats\tgreedy\t\tscheduled\tbound\t\t(%s %s %s, %s meals)\n" \
+	"$DIE" "$EAT" "$SLEEP" "$MEALS"
+for seats in $SEATS; do
+	greedy=$(rate "$@" "$seats")
+	scheduled=$(rate --scheduled "$@" "$seats")
+	echo "$seats $greedy $scheduled" | awk '{
+		printf "%s\t%s (%.1f%%)\t%s (%.1f%%)\t%s\n",
+			$1, $2, 100 * $2 / $3, $4, 100 * $4 / $5, $3 }'
+done
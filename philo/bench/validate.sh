@@ -0,0 +1,37 @@
+#!/bin/bash
+# **************************************************************************** #
+#                                                                              #
+#    validate.sh - checks the logs of philo runs with philo_validator          #
+#                                                                              #
+#    Usage: bench/validate.sh [philo options...]                               #
+#    Environment: SEATS (list), DIE, EAT, SLEEP, MEALS                         #
+#                                                                              #
+#    For each table size, streams the log of a fed table of MEALS meals and   #
+#    of a starving table through philo_validator, with the given options,     #
+#    and prints the number of lines checked and of violations found.          #
+#                                                                              #
+# **************************************************************************** #
+
+PHILO=${PHILO:-./philo}
+VALIDATOR=${VALIDATOR:-./philo_validator}
+SEATS=${SEATS:-"1 2 5 31 100 300"}
+DIE=${DIE:-800}
+EAT=${EAT:-100}
+SLEEP=${SLEEP:-100}
+MEALS=${MEALS:-50}
+
+validate()
+{
+	local report
+	report=$("$PHILO" "$@" | "$VALIDATOR" "$@" 2>&1)
+	echo "$report" | grep "^line" >&2
+	echo "$report" | sed -n "s/^validator\tlines \([0-9]*\)\tviolations \([0-9]*\)/\1\t\2/p"
+}
+
+printf "seats\ttable\t\tlines\tviolations\n"
+for seats in $SEATS; do
+	printf "%s\tfed\t\t%s\n" "$seats" \
+		"$(validate "$@" "$seats" "$DIE" "$EAT" "$SLEEP" "$MEALS")"
+	printf "%s\tstarving\t%s\n" "$seats" \
+		"$(validate "$@" "$seats" $((EAT * 3 / 2)) "$EAT" "$SLEEP")"
+done
@@ -0,0 +1,169 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   checkpoint.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 23:02:36 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 23:02:36 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Records the activity a philosopher just logged.
+ *
+ * Called with the party's dying mutex held, right after the event is
+ * printed, so that a snapshot taken under the same mutex matches the log
+ * up to that point: the activity and when it started, the forks held, the
+ * meals counted and the start of the last meal. Does nothing unless
+ * checkpoints are enabled.
+ *
+ * @param philosopher A pointer to the t_philosopher struct logging.
+ * @param event The event logged.
+ */
+void	note_activity(t_philosopher *philosopher, t_philo_event_type event)
+{
+	if (philosopher->party->checkpoint == NULL)
+		return ;
+	philosopher->activity = event;
+	philosopher->activity_since = get_current_time();
+	philosopher->activity_meals = philosopher->meal_count;
+	if (event == PHILO_TOOK_FORK)
+		philosopher->forks_held++;
+	else if (event == PHILO_EATING)
+		philosopher->last_meal_logged = philosopher->activity_since;
+	else
+		philosopher->forks_held = 0;
+}
+
+/**
+ * @brief Captures the state of one seat at a given time.
+ *
+ * A meal whose time_to_eat has elapsed is recorded as over: its forks may
+ * already be back on the table and taken by a neighbour who logged it,
+ * while the eater has not logged sleeping yet. The philosopher is then
+ * recorded as sleeping since the end of the meal.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @param i The index of the philosopher.
+ * @param now The time of the snapshot in us.
+ */
+static void	capture_seat(t_party *party, unsigned int i,
+		unsigned long long now)
+{
+	t_philosopher		*philosopher;
+	t_checkpoint_seat	*seat;
+
+	philosopher = &(party->philosophers[i]);
+	seat = &(party->checkpoint[i]);
+	seat->since_ate = now - philosopher->last_meal_logged;
+	seat->elapsed = now - philosopher->activity_since;
+	seat->meal_count = philosopher->activity_meals;
+	seat->activity = philosopher->activity;
+	seat->forks_held = philosopher->forks_held;
+	seat->padding = 0;
+	if (seat->activity == PHILO_EATING && seat->elapsed >= party->time_to_eat)
+	{
+		seat->activity = PHILO_SLEEPING;
+		seat->elapsed -= party->time_to_eat;
+		seat->meal_count++;
+		seat->forks_held = 0;
+	}
+}
+
+/**
+ * @brief Captures the table and every seat.
+ *
+ * The seats are captured under the party's dying mutex, which stops the
+ * log for the time of the copy, so that the snapshot matches the log.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @param header A pointer to the t_checkpoint_header to fill.
+ */
+static void	capture_table(t_party *party, t_checkpoint_header *header)
+{
+	unsigned long long	now;
+	unsigned int		i;
+
+	memset(header, 0, sizeof(t_checkpoint_header));
+	memcpy(header->magic, CHECKPOINT_MAGIC, sizeof(header->magic));
+	header->number_of_philosophers = party->number_of_philosophers;
+	header->number_of_meals = party->number_of_meals;
+	header->time_to_die = party->time_to_die;
+	header->time_to_eat = party->time_to_eat;
+	header->time_to_sleep = party->time_to_sleep;
+	pthread_mutex_lock(&(party->dying));
+	now = get_current_time();
+	header->time = now - party->party_start_time;
+	i = 0;
+	while (i < party->number_of_philosophers)
+		capture_seat(party, i++, now);
+	pthread_mutex_unlock(&(party->dying));
+}
+
+/**
+ * @brief Writes a snapshot of the running party to the checkpoint file.
+ *
+ * The file is a t_checkpoint_header followed by one t_checkpoint_seat per
+ * philosopher, in the byte order of the machine. It is written once the
+ * party's dying mutex is released.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ */
+static void	write_checkpoint(t_party *party)
+{
+	t_checkpoint_header	header;
+	FILE				*file;
+
+	capture_table(party, &header);
+	file = fopen(party->options.checkpoint_file, "wb");
+	if (file == NULL || fwrite(&header, sizeof(header), 1, file) != 1
+		|| fwrite(party->checkpoint, sizeof(t_checkpoint_seat),
+			party->number_of_philosophers, file)
+		!= party->number_of_philosophers)
+		fprintf(stderr, "checkpoint\tfailed to write %s\n",
+			party->options.checkpoint_file);
+	else
+		fprintf(stderr, "checkpoint\tat %llu ms\tfile %s\n",
+			header.time / 1000ULL, party->options.checkpoint_file);
+	if (file != NULL)
+		fclose(file);
+}
+
+/**
+ * @brief Takes a snapshot if one is due, from the monitor's loop.
+ *
+ * A snapshot is due once the party reaches `--checkpoint-at MS`, and each
+ * time SIGUSR1 is received. The signal is blocked in every thread and
+ * collected here without waiting, so it never interrupts a philosopher.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ */
+void	check_checkpoint(t_party *party)
+{
+	sigset_t		signals;
+	struct timespec	no_wait;
+	int				due;
+
+	if (party->checkpoint == NULL)
+		return ;
+	due = 0;
+	if (party->options.checkpoint_at && party->checkpoint_taken == 0
+		&& get_current_time() - party->party_start_time
+		>= party->options.checkpoint_at * 1000ULL)
+	{
+		party->checkpoint_taken = 1;
+		due = 1;
+	}
+	sigemptyset(&signals);
+	sigaddset(&signals, SIGUSR1);
+	no_wait.tv_sec = 0;
+	no_wait.tv_nsec = 0;
+	if (sigtimedwait(&signals, NULL, &no_wait) == SIGUSR1)
+		due = 1;
+	if (due)
+		write_checkpoint(party);
+}
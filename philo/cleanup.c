@@ -16,25 +16,29 @@
  *
  * This function is responsible for cleaning up resources and destroying the 
  * mutexes associated with the forks and meal updates for each philosopher. 
- * It also frees the memory allocated for the philosophers and forks arrays.
+ * Only what party->prepared counts as initialized is destroyed, so it also 
+ * releases a party whose `prepare_party` failed halfway. It also frees the 
+ * memory allocated for the philosophers and forks arrays and for the eating 
+ * schedule.
  *
  * @param party	A pointer to party struct
  */
 void	clean_up(t_party	*party)
 {
-	unsigned int	i;
-
-	i = 0;
-	while (i < party->number_of_philosophers)
-	{
-		pthread_mutex_destroy(&(party->forks[i]));
-		pthread_mutex_destroy(&(party->philosophers[i].meal_update));
-		i++;
-	}
-	pthread_mutex_destroy(&(party->guard));
-	pthread_mutex_destroy(&(party->dying));
+	destroy_party_locks(party);
+	if (party->prepared.spawning > 2)
+		pthread_cond_destroy(&(party->spawn_reported));
+	if (party->prepared.spawning > 1)
+		pthread_mutex_destroy(&(party->spawning));
+	if (party->prepared.spawning > 0)
+		pthread_attr_destroy(&(party->thread_attributes));
+	party->prepared.spawning = 0;
 	free(party->philosophers);
 	free(party->forks);
+	free(party->schedule);
+	free(party->latency);
+	free(party->checkpoint);
+	free(party->restored);
 }
 
 /**
@@ -89,7 +93,8 @@ static t_return_value	join_monitoring_thread(t_party *party)
  *
  * This function joins the threads of each philosopher and the monitoring 
  * thread to ensure all threads have completed their tasks before exiting the 
- * program. If any join operation fails, it prints an error message and returns
+ * program, then stops the injected disturbances with `stop_disturbances`. 
+ * If any join operation fails, it prints an error message and returns
  * JOIN_FAIL.
  *
  * @param party	A pointer to party struct
@@ -97,12 +102,11 @@ static t_return_value	join_monitoring_thread(t_party *party)
  */
 t_return_value	join_threads_to_exit_party(t_party *party)
 {
-	if (join_monitoring_thread(party) == JOIN_FAIL)
-	{
-		join_philosopher_threads(party);
-		return (JOIN_FAIL);
-	}
-	else if (join_philosopher_threads(party) == JOIN_FAIL)
-		return (JOIN_FAIL);
-	return (SUCCESS);
+	t_return_value	ret_val;
+
+	ret_val = join_monitoring_thread(party);
+	if (join_philosopher_threads(party) == JOIN_FAIL)
+		ret_val = JOIN_FAIL;
+	stop_disturbances(party);
+	return (ret_val);
 }
@@ -0,0 +1,170 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   coordinator.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:47:19 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 15:47:19 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Stops every segment of the table but the given one.
+ *
+ * Only the first stop counts: it stamps the end of the table and records
+ * its outcome, which is sent along so every segment ends the same way.
+ * Segments gone away are left out and count as quiet already.
+ *
+ * @param coordinator A pointer to the t_coordinator struct.
+ * @param outcome SOMEONE_DIED, EVERYONE_IS_FED, or ERROR if a segment was
+ * lost.
+ * @param winner The segment whose death ends the table, or -1.
+ */
+static void	stop_table(t_coordinator *coordinator, t_return_value outcome,
+		int winner)
+{
+	unsigned int	s;
+
+	if (coordinator->stopping)
+		return ;
+	coordinator->stopping = 1;
+	coordinator->outcome = outcome;
+	coordinator->winner = winner;
+	coordinator->end_time = get_current_time();
+	s = 0;
+	while (s < coordinator->count)
+	{
+		if ((int)s != winner && coordinator->segments[s].fd >= 0)
+			send_segment_message(coordinator->segments[s].fd, SEGMENT_STOP,
+				0, outcome);
+		s++;
+	}
+}
+
+/**
+ * @brief Lets the winning segment print its death once the others are quiet.
+ *
+ * A segment is quiet once it has acknowledged the stop or gone away, and
+ * then prints nothing anymore, so the death is the last line of the log.
+ *
+ * @param coordinator A pointer to the t_coordinator struct.
+ */
+static void	grant_death_when_quiet(t_coordinator *coordinator)
+{
+	unsigned int	s;
+
+	if (coordinator->winner < 0 || coordinator->death_granted)
+		return ;
+	s = 0;
+	while (s < coordinator->count)
+	{
+		if ((int)s != coordinator->winner && coordinator->quiet[s] == 0)
+			return ;
+		s++;
+	}
+	send_segment_message(coordinator->segments[coordinator->winner].fd,
+		SEGMENT_PRINT, 0, 0);
+	coordinator->death_granted = 1;
+}
+
+/**
+ * @brief Starts the table once every segment is ready.
+ *
+ * All segments get the same start time, so their logs share one clock.
+ *
+ * @param coordinator A pointer to the t_coordinator struct.
+ */
+static void	start_table(t_coordinator *coordinator)
+{
+	unsigned int	s;
+
+	coordinator->ready++;
+	if (coordinator->ready < coordinator->count || coordinator->stopping)
+		return ;
+	coordinator->start_time = get_current_time();
+	s = 0;
+	while (s < coordinator->count)
+	{
+		send_segment_message(coordinator->segments[s].fd, SEGMENT_GO, 0,
+			coordinator->start_time);
+		s++;
+	}
+}
+
+/**
+ * @brief Handles a control message from a segment.
+ *
+ * The first death ends the table; deaths reported after it are dropped, as
+ * their segments are being stopped. The table is fed once every segment has
+ * reported its seats fed.
+ *
+ * @param coordinator A pointer to the t_coordinator struct.
+ * @param s The index of the segment the message comes from.
+ * @param message A pointer to the t_segment_message received.
+ */
+static void	handle_message(t_coordinator *coordinator, unsigned int s,
+		t_segment_message *message)
+{
+	if (message->type == SEGMENT_READY)
+		start_table(coordinator);
+	else if (message->type == SEGMENT_DIED)
+		stop_table(coordinator, SOMEONE_DIED, (int)s);
+	else if (message->type == SEGMENT_FED)
+	{
+		coordinator->fed++;
+		if (coordinator->fed == coordinator->count)
+			stop_table(coordinator, EVERYONE_IS_FED, -1);
+	}
+	else if (message->type == SEGMENT_ACK)
+		coordinator->quiet[s] = 1;
+	else if (message->type == SEGMENT_MEALS)
+		coordinator->meals += message->value;
+}
+
+/**
+ * @brief Coordinates the segments of a `--segments` table until they exit.
+ *
+ * The coordinator owns no seat: it starts the table once every segment is
+ * ready, decides its end on the first death or once every segment is fed,
+ * orders the death line after every other segment is quiet, and adds up
+ * the meals the segments report when they leave. A segment missing from 
+ * the start or closing its socket before the end stops the table with 
+ * ERROR.
+ *
+ * @param coordinator A pointer to the t_coordinator struct, with the parent
+ * ends of the segments' control sockets.
+ */
+void	coordinate_segments(t_coordinator *coordinator)
+{
+	unsigned int		s;
+	t_segment_message	message;
+
+	if (coordinator->open < coordinator->count)
+		stop_table(coordinator, ERROR, -1);
+	while (coordinator->open > 0
+		&& poll(coordinator->segments, coordinator->count, -1) > 0)
+	{
+		s = 0;
+		while (s < coordinator->count)
+		{
+			if (coordinator->segments[s].revents != 0
+				&& recv(coordinator->segments[s].fd, &message,
+					sizeof(t_segment_message), 0) == sizeof(t_segment_message))
+				handle_message(coordinator, s, &message);
+			else if (coordinator->segments[s].revents != 0)
+			{
+				close(coordinator->segments[s].fd);
+				coordinator->segments[s].fd = -1;
+				coordinator->quiet[s] = 1;
+				coordinator->open--;
+				stop_table(coordinator, ERROR, -1);
+			}
+			s++;
+		}
+		grant_death_when_quiet(coordinator);
+	}
+}
@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cpu_account.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:31:08 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 19:31:08 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "philosophers.h"
+
+/**
+ * @brief Reads the CPU time consumed so far by the calling thread.
+ *
+ * @return unsigned long long The thread's CPU time in ns.
+ */
+static unsigned long long	thread_cpu_time(void)
+{
+	struct timespec	now;
+
+	if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now) != 0)
+		return (0);
+	return (now.tv_sec * 1000000000ULL + now.tv_nsec);
+}
+
+/**
+ * @brief Starts the CPU account of the calling thread.
+ *
+ * Must be called by the thread being accounted, as the thread's own CPU
+ * clock is read.
+ *
+ * @param account A pointer to the t_cpu_account of the thread.
+ * @param enabled Whether `--cpu-stats` was given.
+ * @param phase The phase the thread starts in.
+ */
+void	cpu_start(t_cpu_account *account, int enabled, t_cpu_phase phase)
+{
+	memset(account, 0, sizeof(t_cpu_account));
+	account->enabled = enabled;
+	account->phase = phase;
+	if (enabled)
+		account->mark = thread_cpu_time();
+}
+
+/**
+ * @brief Moves the calling thread to another phase.
+ *
+ * The CPU time used since the last change is charged to the phase being
+ * left. Without `--cpu-stats` nothing is measured.
+ *
+ * @param account A pointer to the t_cpu_account of the thread.
+ * @param phase The phase entered.
+ * @return t_cpu_phase The phase left, so that it can be resumed.
+ */
+t_cpu_phase	cpu_phase(t_cpu_account *account, t_cpu_phase phase)
+{
+	t_cpu_phase			left;
+	unsigned long long	now;
+
+	left = account->phase;
+	if (account->enabled == 0)
+		return (left);
+	now = thread_cpu_time();
+	account->time[left] += now - account->mark;
+	account->mark = now;
+	account->phase = phase;
+	return (left);
+}
+
+/**
+ * @brief Closes the CPU account of the calling thread.
+ *
+ * Charges the last phase and reads the thread's context switches with
+ * getrusage(RUSAGE_THREAD), a Linux extension.
+ *
+ * @param account A pointer to the t_cpu_account of the thread.
+ */
+void	cpu_stop(t_cpu_account *account)
+{
+	struct rusage	usage;
+
+	if (account->enabled == 0)
+		return ;
+	cpu_phase(account, account->phase);
+	if (getrusage(RUSAGE_THREAD, &usage) == 0)
+	{
+		account->voluntary_switches = usage.ru_nvcsw;
+		account->involuntary_switches = usage.ru_nivcsw;
+	}
+}
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cpu_report.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:44:52 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 19:44:52 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Adds up the CPU accounts of every philosopher.
+ *
+ * Called once the threads are joined, so no locking is needed.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @param total A pointer to the t_cpu_account receiving the sums.
+ */
+static void	sum_philosophers(t_party *party, t_cpu_account *total)
+{
+	unsigned int		i;
+	int					phase;
+	t_cpu_account		*account;
+
+	memset(total, 0, sizeof(t_cpu_account));
+	i = 0;
+	while (i < party->number_of_philosophers)
+	{
+		account = &(party->philosophers[i].cpu);
+		phase = 0;
+		while (phase < CPU_PHASES)
+		{
+			total->time[phase] += account->time[phase];
+			phase++;
+		}
+		total->voluntary_switches += account->voluntary_switches;
+		total->involuntary_switches += account->involuntary_switches;
+		i++;
+	}
+}
+
+/**
+ * @brief Sums the CPU time of an account over all its phases.
+ *
+ * @param account A pointer to the t_cpu_account.
+ * @return unsigned long long The CPU time in ns.
+ */
+static unsigned long long	account_total(t_cpu_account *account)
+{
+	unsigned long long	total;
+	int					phase;
+
+	total = 0;
+	phase = 0;
+	while (phase < CPU_PHASES)
+		total += account->time[phase++];
+	return (total);
+}
+
+/**
+ * @brief Prints where the CPU time of the party went, to stderr.
+ *
+ * With `--cpu-stats`, the CPU time of the philosophers is split by phase:
+ * waiting for forks, eating, sleeping, printing the log and thinking. The
+ * monitor's CPU time and the context switches follow, then the CPU time
+ * spent per meal by all threads together: the efficiency of the whole
+ * simulation. The meals are the finished ones of `table_meal_count`, as in
+ * `--stats`.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ */
+void	report_cpu_statistics(t_party *party)
+{
+	t_cpu_account		total;
+	unsigned long long	philosophers;
+	unsigned long long	monitor;
+	unsigned long long	meals;
+
+	sum_philosophers(party, &total);
+	meals = table_meal_count(party);
+	philosophers = account_total(&total);
+	monitor = account_total(&(party->monitor_cpu));
+	fprintf(stderr, "cpu\tphilosophers %.3f s\tfork wait %.3f s\teating %.3f s"
+		"\tsleeping %.3f s\tlogging %.3f s\tthinking %.3f s\n",
+		philosophers / 1e9, total.time[CPU_FORK_WAIT] / 1e9,
+		total.time[CPU_EATING] / 1e9, total.time[CPU_SLEEPING] / 1e9,
+		total.time[CPU_LOGGING] / 1e9, total.time[CPU_THINKING] / 1e9);
+	fprintf(stderr, "cpu\tmonitor %.3f s\tswitches philosophers %ld/%ld\t"
+		"monitor %ld/%ld (voluntary/involuntary)\n", monitor / 1e9,
+		total.voluntary_switches, total.involuntary_switches,
+		party->monitor_cpu.voluntary_switches,
+		party->monitor_cpu.involuntary_switches);
+	fprintf(stderr, "cpu\tper meal %.1f us\tmeals %llu\n",
+		(philosophers + monitor) / 1e3 / (meals + (meals == 0)), meals);
+}
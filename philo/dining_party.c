@@ -0,0 +1,171 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   dining_party.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:32:50 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 13:32:50 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+/**
+ * @brief Initializes the party start time and sets the time_last_ate for all 
+ * philosophers.
+ *
+ * This function initializes the party's start time to the current time and 
+ * sets the time_last_ate for each philosopher to the party's start time. It 
+ * updates the time_last_ate of each philosopher to the party's start time, 
+ * indicating that they have not eaten since the party's inception. The first
+ * round of the scheduled mode also begins at the party's start time. A 
+ * segment of a `--segments` table uses the start time shared by the 
+ * coordinator instead, so that all processes log on the same clock. A 
+ * party restored from a snapshot is then set back to it by `apply_restore`.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ */
+static void	initialize_party_start_time(t_party *party)
+{
+	unsigned int	i;
+
+	i = 0;
+	party->party_start_time = get_current_time();
+	if (party->segment.count > 1)
+		party->party_start_time = party->segment.start_time;
+	party->round_start_time = party->party_start_time;
+	while (i < party->number_of_philosophers)
+	{
+		party->philosophers[i].time_last_ate = party->party_start_time;
+		party->philosophers[i].last_meal_logged = party->party_start_time;
+		party->philosophers[i].activity_since = party->party_start_time;
+		i++;
+	}
+	if (party->restored != NULL)
+		apply_restore(party);
+}
+
+/**
+ * @brief Aborts the start of a party after a thread creation failure.
+ *
+ * The philosophers whose thread was started are told that the party is 
+ * over, the party's guard mutex is unlocked so they can leave their 
+ * routine, and they are joined so that no thread outlives the party, nor 
+ * any disturbance.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return t_return_value Always THREAD_FAIL.
+ */
+static t_return_value	abort_party_start(t_party *party)
+{
+	unsigned int	i;
+
+	pthread_mutex_lock(&(party->dying));
+	party->someone_dead = 1;
+	pthread_mutex_unlock(&(party->dying));
+	pthread_mutex_unlock(&(party->guard));
+	i = 0;
+	while (i < party->number_of_philosophers)
+	{
+		if (party->philosophers[i].thread_started)
+			pthread_join(party->philosophers[i].thread, NULL);
+		i++;
+	}
+	stop_disturbances(party);
+	party->joined = 1;
+	return (THREAD_FAIL);
+}
+
+/**
+ * @brief Initializes the dining party.
+ *
+ * This function starts the dining party by creating threads for each 
+ * philosopher using the `spawn_philosophers` function. If all threads are 
+ * successfully created, the function records how long that took and the 
+ * memory footprint at that point, waits for the other segments of the 
+ * table with `join_segments` if the party is one, initializes the party 
+ * start time using 
+ * `initialize_party_start_time` and starts the monitoring thread using 
+ * `start_monitoring`. If creating any thread fails, the function aborts the 
+ * start with `abort_party_start`, which also unlocks the party's guard mutex, 
+ * and returns THREAD_FAIL. Otherwise, it returns SUCCESS.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return t_return_value The return value indicating the result of 
+ * initializing the party.
+ */
+static t_return_value	initialize_party(t_party *party)
+{
+	unsigned long long	spawn_start;
+
+	spawn_start = get_current_time();
+	if (spawn_philosophers(party) == THREAD_FAIL)
+		return (abort_party_start(party));
+	party->spawn_duration = get_current_time() - spawn_start;
+	measure_startup_footprint(party);
+	if (party->segment.count > 1 && join_segments(party) != SUCCESS)
+		return (abort_party_start(party));
+	initialize_party_start_time(party);
+	if (start_monitoring(party) == THREAD_FAIL)
+		return (abort_party_start(party));
+	return (SUCCESS);
+}
+
+/**
+ * @brief Starts the dining party.
+ *
+ * This function starts the disturbances of the `--burners` and 
+ * `--backpressure` harness with `start_disturbances`, then locks the party's 
+ * guard mutex, initializes and starts the party using the 
+ * `initialize_party` function. After initializing and 
+ * starting the party, it unlocks the party's guard mutex to allow all 
+ * philosophers to start their routines concurrently, and returns without 
+ * waiting for the party to end.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return t_return_value SUCCESS, THREAD_FAIL or the failure of 
+ * `start_disturbances`
+ */
+t_return_value	start_dining_party(t_party *party)
+{
+	t_return_value	ret_val;
+
+	ret_val = start_disturbances(party);
+	if (ret_val != SUCCESS)
+	{
+		stop_disturbances(party);
+		return (ret_val);
+	}
+	pthread_mutex_lock(&(party->guard));
+	if (initialize_party(party) == THREAD_FAIL)
+		return (THREAD_FAIL);
+	party->started = 1;
+	pthread_mutex_unlock(&(party->guard));
+	return (SUCCESS);
+}
+
+/**
+ * @brief Runs the dining party.
+ *
+ * This function is the core of the dining party process. It starts the 
+ * party using `start_dining_party`, then waits for all threads to finish 
+ * using the `join_threads_to_exit_party` function. If joining any thread 
+ * fails, the function returns JOIN_FAIL. Otherwise, it returns SUCCESS.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return t_return_value SUCCESS, the failure of `start_dining_party` or 
+ * JOIN_FAIL
+ */
+t_return_value	run_dining_party(t_party *party)
+{
+	t_return_value	ret_val;
+
+	ret_val = start_dining_party(party);
+	if (ret_val != SUCCESS)
+		return (ret_val);
+	party->joined = 1;
+	if (join_threads_to_exit_party(party) == JOIN_FAIL)
+		return (JOIN_FAIL);
+	return (SUCCESS);
+}
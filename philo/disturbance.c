@@ -0,0 +1,161 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   disturbance.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 22:10:48 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 22:10:48 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Draws the random delay `--jitter MS` adds to a pause.
+ *
+ * The delay is uniform between 0 and MS ms. Each philosopher draws from
+ * their own seed, so no lock is needed.
+ *
+ * @param philosopher A pointer to the t_philosopher struct pausing.
+ * @return unsigned long long The delay in us, 0 without `--jitter`.
+ */
+unsigned long long	jitter_delay(t_philosopher *philosopher)
+{
+	unsigned long long	range;
+
+	if (philosopher->party->options.jitter == 0)
+		return (0);
+	range = philosopher->party->options.jitter * 1000ULL + 1;
+	return ((unsigned long long)rand_r(&(philosopher->jitter_seed)) % range);
+}
+
+/**
+ * @brief Burns CPU until the disturbances are stopped.
+ *
+ * A burner competes with the philosophers for the CPUs: it spins
+ * BURNER_SPIN iterations between two checks of the stop flag.
+ *
+ * @param party_data A pointer to the t_party struct representing the party.
+ * @return void* Always NULL.
+ */
+static void	*burner_routine(void *party_data)
+{
+	t_disturbance		*disturbance;
+	volatile unsigned	spin;
+	int					stopping;
+
+	disturbance = &(((t_party *)party_data)->disturbance);
+	stopping = 0;
+	while (stopping == 0)
+	{
+		spin = 0;
+		while (spin < BURNER_SPIN)
+			spin++;
+		pthread_mutex_lock(&(disturbance->stop));
+		stopping = disturbance->stopping;
+		pthread_mutex_unlock(&(disturbance->stop));
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Starts the CPU burner threads of `--burners K`.
+ *
+ * The burners run under the default policy, see `init_default_policy`:
+ * under `--realtime`, SCHED_FIFO burners at the philosophers' priority
+ * would never be preempted, and with fewer CPUs than burners the
+ * philosophers would starve.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return t_return_value SUCCESS, MALLOC_FAIL or THREAD_FAIL
+ */
+static t_return_value	start_burners(t_party *party)
+{
+	t_disturbance	*disturbance;
+	pthread_attr_t	attributes;
+	int				error;
+
+	disturbance = &(party->disturbance);
+	disturbance->burners = malloc(sizeof(pthread_t) * party->options.burners);
+	if (disturbance->burners == NULL)
+		return (MALLOC_FAIL);
+	if (init_default_policy(&attributes) != SUCCESS)
+		return (THREAD_FAIL);
+	error = 0;
+	while (error == 0 && disturbance->burners_started < party->options.burners)
+	{
+		error = pthread_create(disturbance->burners
+				+ disturbance->burners_started, &attributes, burner_routine,
+				party);
+		disturbance->burners_started += (error == 0);
+	}
+	pthread_attr_destroy(&attributes);
+	if (error == 0)
+		return (SUCCESS);
+	printf("Failed to create a burner thread\n");
+	return (THREAD_FAIL);
+}
+
+/**
+ * @brief Starts the disturbances injected around the party.
+ *
+ * `--burners K` starts K threads spinning on the CPUs and `--backpressure KB`
+ * routes stdout through a slow pipe, see `start_backpressure`. The random
+ * delays of `--jitter` need nothing to start. On failure, whatever was
+ * started must still be stopped with `stop_disturbances`.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return t_return_value SUCCESS, MUTEX_FAIL, MALLOC_FAIL, THREAD_FAIL or
+ * ERROR
+ */
+t_return_value	start_disturbances(t_party *party)
+{
+	t_return_value	ret_val;
+
+	party->disturbance.burners = NULL;
+	party->disturbance.burners_started = 0;
+	party->disturbance.stopping = 0;
+	party->disturbance.saved_stdout = -1;
+	if (party->options.burners == 0 && party->options.backpressure == 0)
+		return (SUCCESS);
+	if (pthread_mutex_init(&(party->disturbance.stop), NULL) != 0)
+		return (MUTEX_FAIL);
+	party->disturbance.active = 1;
+	ret_val = SUCCESS;
+	if (party->options.burners)
+		ret_val = start_burners(party);
+	if (ret_val == SUCCESS && party->options.backpressure)
+		ret_val = start_backpressure(party);
+	return (ret_val);
+}
+
+/**
+ * @brief Stops the disturbances once the party is over.
+ *
+ * The burners are told to stop and joined, then stdout is given back with
+ * `stop_backpressure`. Does nothing if no disturbance was started.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ */
+void	stop_disturbances(t_party *party)
+{
+	t_disturbance	*disturbance;
+
+	disturbance = &(party->disturbance);
+	if (disturbance->active == 0)
+		return ;
+	disturbance->active = 0;
+	pthread_mutex_lock(&(disturbance->stop));
+	disturbance->stopping = 1;
+	pthread_mutex_unlock(&(disturbance->stop));
+	while (disturbance->burners_started > 0)
+	{
+		disturbance->burners_started--;
+		pthread_join(disturbance->burners[disturbance->burners_started], NULL);
+	}
+	free(disturbance->burners);
+	pthread_mutex_destroy(&(disturbance->stop));
+	stop_backpressure(party);
+}
@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_wait.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 18:34:51 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 18:34:51 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Publishes the fork a philosopher is blocked on, for the monitor.
+ *
+ * Together with the holder of every fork, this is the wait-for graph walked
+ * by `start_fork_wait` and `detect_deadlock`. The time the wait started
+ * tells one wait from the next. Nothing is published without `--deadlock`,
+ * so that the waits of a party that does not look for deadlocks cost no
+ * extra locking.
+ *
+ * @param philosopher A pointer to the waiting t_philosopher struct.
+ * @param fork The fork waited for, or NULL once the wait is over.
+ */
+void	note_fork_wait(t_philosopher *philosopher, t_fork *fork)
+{
+	if (philosopher->party->options.deadlock == 0)
+		return ;
+	pthread_mutex_lock(&(philosopher->meal_update));
+	philosopher->waiting_for = fork;
+	if (fork != NULL)
+		philosopher->waiting_since = get_current_time();
+	pthread_mutex_unlock(&(philosopher->meal_update));
+}
+
+/**
+ * @brief Checks if the party has ended, for a philosopher blocked on a fork.
+ *
+ * @param party A pointer to the t_party struct.
+ * @return int 1 if party->someone_dead is set, 0 otherwise.
+ */
+static int	party_has_ended(t_party *party)
+{
+	int	someone_dead;
+
+	pthread_mutex_lock(&(party->dying));
+	someone_dead = party->someone_dead;
+	pthread_mutex_unlock(&(party->dying));
+	return (someone_dead != 0);
+}
+
+/**
+ * @brief Blocks on a fork for at most FORK_WAIT_TIMEOUT us.
+ *
+ * @param fork A pointer to the t_fork struct.
+ * @return int 0 once the fork is locked, an error number otherwise.
+ */
+static int	lock_within_slice(t_fork *fork)
+{
+	struct timespec		timeout;
+	unsigned long long	wake_up;
+
+	wake_up = get_current_time() + FORK_WAIT_TIMEOUT;
+	timeout.tv_sec = wake_up / 1000000ULL;
+	timeout.tv_nsec = (wake_up % 1000000ULL) * 1000;
+	return (pthread_mutex_timedlock(&(fork->lock), &timeout));
+}
+
+/**
+ * @brief Picks up a plain mutex fork.
+ *
+ * Without `--deadlock`, the fork is a plain blocking lock. With it, a free
+ * fork is taken right away. Otherwise the philosopher publishes the wait
+ * with `start_fork_wait` and blocks in FORK_WAIT_TIMEOUT us slices, so that
+ * a philosopher stuck in a deadlock still leaves once the monitor ends the
+ * party. The new holder is recorded under the fork's arbiter mutex.
+ *
+ * @param philosopher A pointer to the t_philosopher struct picking the fork.
+ * @param fork A pointer to the t_fork struct.
+ * @return t_return_value SUCCESS once the fork is held, or SOMEONE_DIED if
+ * the party ended while waiting for it.
+ */
+t_return_value	lock_fork(t_philosopher *philosopher, t_fork *fork)
+{
+	int	waited;
+
+	if (philosopher->party->options.deadlock == 0)
+	{
+		pthread_mutex_lock(&(fork->lock));
+		return (SUCCESS);
+	}
+	waited = (pthread_mutex_trylock(&(fork->lock)) != 0);
+	if (waited)
+		start_fork_wait(philosopher, fork);
+	while (waited && lock_within_slice(fork) != 0)
+	{
+		if (party_has_ended(philosopher->party))
+		{
+			note_fork_wait(philosopher, NULL);
+			return (SOMEONE_DIED);
+		}
+	}
+	pthread_mutex_lock(&(fork->arbiter));
+	fork->holder = philosopher;
+	pthread_mutex_unlock(&(fork->arbiter));
+	if (waited)
+		note_fork_wait(philosopher, NULL);
+	return (SUCCESS);
+}
+
+/**
+ * @brief Puts a plain mutex fork back on the table.
+ *
+ * The holder is only recorded with `--deadlock`, see `lock_fork`.
+ *
+ * @param philosopher A pointer to the t_philosopher struct releasing it.
+ * @param fork A pointer to the t_fork struct.
+ */
+void	unlock_fork(t_philosopher *philosopher, t_fork *fork)
+{
+	if (philosopher->party->options.deadlock)
+	{
+		pthread_mutex_lock(&(fork->arbiter));
+		fork->holder = NULL;
+		pthread_mutex_unlock(&(fork->arbiter));
+	}
+	pthread_mutex_unlock(&(fork->lock));
+}
@@ -0,0 +1,187 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   forks.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:04:33 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 12:04:33 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Removes the most urgent waiter from a fork's queue.
+ *
+ * The most urgent waiter is the one with the earliest deadline, i.e. the
+ * smallest time_last_ate + time_to_die. Must be called with the fork's
+ * arbiter mutex held and at least one waiter queued.
+ *
+ * @param fork A pointer to the t_fork struct.
+ * @return t_philosopher* The philosopher removed from the queue.
+ */
+static t_philosopher	*dequeue_most_urgent(t_fork *fork)
+{
+	unsigned int	i;
+	unsigned int	most_urgent;
+	t_philosopher	*waiter;
+
+	i = 1;
+	most_urgent = 0;
+	while (i < fork->waiter_count)
+	{
+		if (fork->deadlines[i] < fork->deadlines[most_urgent])
+			most_urgent = i;
+		i++;
+	}
+	waiter = fork->waiters[most_urgent];
+	fork->waiter_count--;
+	fork->waiters[most_urgent] = fork->waiters[fork->waiter_count];
+	fork->deadlines[most_urgent] = fork->deadlines[fork->waiter_count];
+	return (waiter);
+}
+
+/**
+ * @brief Removes a given philosopher from a fork's queue.
+ *
+ * Used when a waiter gives up because the party ended. Must be called with
+ * the fork's arbiter mutex held.
+ *
+ * @param fork A pointer to the t_fork struct.
+ * @param philosopher The philosopher to remove.
+ */
+static void	dequeue(t_fork *fork, t_philosopher *philosopher)
+{
+	unsigned int	i;
+
+	i = 0;
+	while (i < fork->waiter_count && fork->waiters[i] != philosopher)
+		i++;
+	if (i == fork->waiter_count)
+		return ;
+	fork->waiter_count--;
+	fork->waiters[i] = fork->waiters[fork->waiter_count];
+	fork->deadlines[i] = fork->deadlines[fork->waiter_count];
+}
+
+/**
+ * @brief Waits until a fork is handed over to the philosopher.
+ *
+ * The philosopher sleeps on the fork's condition variable and wakes up at
+ * least every FORK_WAIT_TIMEOUT us to check whether the party has ended.
+ * Must be called with the fork's arbiter mutex held.
+ *
+ * @param philosopher A pointer to the waiting t_philosopher struct.
+ * @param fork A pointer to the t_fork struct.
+ * @return t_return_value SUCCESS once the philosopher holds the fork, or
+ * SOMEONE_DIED if the party ended while waiting.
+ */
+static t_return_value	wait_for_handoff(t_philosopher *philosopher,
+		t_fork *fork)
+{
+	struct timespec		timeout;
+	unsigned long long	wake_up;
+	int					someone_dead;
+
+	while (fork->holder != philosopher)
+	{
+		pthread_mutex_lock(&(philosopher->party->dying));
+		someone_dead = philosopher->party->someone_dead;
+		pthread_mutex_unlock(&(philosopher->party->dying));
+		if (someone_dead != 0)
+		{
+			dequeue(fork, philosopher);
+			return (SOMEONE_DIED);
+		}
+		wake_up = get_current_time() + FORK_WAIT_TIMEOUT;
+		timeout.tv_sec = wake_up / 1000000ULL;
+		timeout.tv_nsec = (wake_up % 1000000ULL) * 1000;
+		pthread_cond_timedwait(&(fork->handed_over), &(fork->arbiter),
+			&timeout);
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @brief Picks up a fork.
+ *
+ * By default the fork is a plain mutex and goes to whichever waiter the
+ * kernel wakes up, see `lock_fork`. With `--edf` the fork is arbitrated: a
+ * free fork is taken right away, otherwise the philosopher queues with their
+ * deadline (time_last_ate + time_to_die) and waits for `release_fork` to
+ * hand the fork over to them. Either way, with `--deadlock`, a philosopher
+ * blocked on a fork publishes it with `start_fork_wait`, which checks if the
+ * wait closes a cycle; the arbiter mutex is let go meanwhile, and a handoff
+ * made in between is seen by `wait_for_handoff`. The fork of the
+ * neighbouring segment of a `--segments` table is requested from its
+ * process with `take_remote_fork`.
+ *
+ * @param philosopher A pointer to the t_philosopher struct picking the fork.
+ * @param fork A pointer to the t_fork struct.
+ * @return t_return_value SUCCESS once the fork is held, or SOMEONE_DIED if
+ * the party ended while waiting for it.
+ */
+t_return_value	take_fork(t_philosopher *philosopher, t_fork *fork)
+{
+	t_return_value	ret_val;
+
+	if (fork->remote >= 0)
+		return (take_remote_fork(philosopher, fork));
+	if (philosopher->party->options.edf == 0)
+		return (lock_fork(philosopher, fork));
+	ret_val = SUCCESS;
+	pthread_mutex_lock(&(fork->arbiter));
+	if (fork->holder == NULL && fork->waiter_count == 0)
+		fork->holder = philosopher;
+	else
+	{
+		fork->waiters[fork->waiter_count] = philosopher;
+		fork->deadlines[fork->waiter_count] = philosopher->time_last_ate
+			+ philosopher->party->time_to_die;
+		fork->waiter_count++;
+		pthread_mutex_unlock(&(fork->arbiter));
+		start_fork_wait(philosopher, fork);
+		pthread_mutex_lock(&(fork->arbiter));
+		ret_val = wait_for_handoff(philosopher, fork);
+		note_fork_wait(philosopher, NULL);
+	}
+	pthread_mutex_unlock(&(fork->arbiter));
+	return (ret_val);
+}
+
+/**
+ * @brief Puts a fork back on the table.
+ *
+ * With `--edf` the fork is handed directly to the philosopher queued for
+ * it, so it cannot be grabbed back by its releaser; it only becomes free if
+ * nobody is waiting. A fork has only two users, so at most one of them is
+ * ever queued, and the deadline order of `dequeue_most_urgent` never has a
+ * choice to make. The fork of the neighbouring segment is given back to its
+ * process.
+ *
+ * @param philosopher A pointer to the t_philosopher struct releasing the fork.
+ * @param fork A pointer to the t_fork struct.
+ */
+void	release_fork(t_philosopher *philosopher, t_fork *fork)
+{
+	if (fork->remote >= 0)
+	{
+		release_remote_fork(fork);
+		return ;
+	}
+	if (philosopher->party->options.edf == 0)
+	{
+		unlock_fork(philosopher, fork);
+		return ;
+	}
+	pthread_mutex_lock(&(fork->arbiter));
+	fork->holder = NULL;
+	if (fork->waiter_count > 0)
+	{
+		fork->holder = dequeue_most_urgent(fork);
+		pthread_cond_broadcast(&(fork->handed_over));
+	}
+	pthread_mutex_unlock(&(fork->arbiter));
+}
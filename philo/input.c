@@ -26,7 +26,7 @@
  * @param str The input ASCII string to be converted.
  * @return unsigned long long The converted value if successful, otherwise 0.
  */
-static unsigned long long	ascii_to_positive_int(const char *str)
+unsigned long long	ascii_to_positive_int(const char *str)
 {
 	unsigned long long	result;
 
@@ -100,7 +100,28 @@ static void	print_philo_usage(void)
 	printf("Usage: ./philo\tnumber_of_philosophers\t(max 200 philos)\n\
 		time_to_die\t(millisecond, ms)\n\t\ttime_to_eat\t(ms)\n\
 		time_to_sleep\t(ms)\n\
-		[number_of_times_each_philosopher_must_eat]\n");
+		[number_of_times_each_philosopher_must_eat]\n\n\
+Options:\t--scheduled\t(conflict-free precomputed eating rounds)\n\
+		--stats\t\t(print meal throughput and slack on exit)\n\
+		--cpu-stats\t(print the CPU time per phase and per meal)\n\
+		--adaptive-think\t(think according to the table and own slack)\n\
+		--edf\t\t(hand released forks to the most urgent waiter)\n\
+		--repeat K\t(run K times with the same threads, print the spread)\n\
+		--stack-size KB\t(thread stack size, 64 KiB by default)\n\
+		--serial-spawn\t(create all threads from the main thread)\n\
+		--segments P\t(split the table over P processes)\n\
+		--processes\t(one process per philosopher, semaphore forks)\n\
+		--livelock MS\t(end the table when nobody ate for MS ms)\n\
+		--deadlock\t(end the table on a cycle of fork waits)\n\
+		--realtime\t(SCHED_FIFO threads, locked memory)\n\
+		--monitor-core C\t(keep CPU C for the monitor alone)\n\
+		--latency\t(print the wakeup latency percentiles)\n\
+		--jitter MS\t(random delays of up to MS ms around each pause)\n\
+		--burners K\t(K threads competing for the CPUs)\n\
+		--backpressure KB\t(drain stdout through a KB KiB/s pipe)\n\
+		--checkpoint FILE\t(snapshot the party to FILE on SIGUSR1)\n\
+		--checkpoint-at MS\t(snapshot the party at MS ms)\n\
+		--restore FILE\t(start the party from the snapshot in FILE)\n");
 }
 
 /**
@@ -134,12 +155,14 @@ static t_return_value	argument_number_check(int argc)
  * simulation.
  *
  * This function parses and validates the command-line arguments provided by 
- * the user for the philosopher simulation. It first checks the number of 
+ * the user for the philosopher simulation. It first extracts the `--option`
+ * arguments using `parse_options`, then checks the number of remaining
  * arguments using `argument_number_check` and then proceeds to validate each 
  * argument using `store_arg_if_validated`. If any argument fails validation, 
  * it prints an appropriate error message along with the usage information 
  * and returns the corresponding error code. If all arguments are valid, it 
- * stores them in the `t_party` struct and returns SUCCESS.
+ * stores them in the `t_party` struct and returns the result of 
+ * `check_option_combinations`.
  *
  * @param party A pointer to the `t_party` struct where the validated 
  * arguments will be stored.
@@ -154,6 +177,11 @@ t_return_value	parse_args(t_party *party, int argc, char **argv)
 	int				index;
 
 	index = 1;
+	if (parse_options(party, &argc, argv) != SUCCESS)
+	{
+		print_philo_usage();
+		return (UNKNOWN_OPTION);
+	}
 	ret_val = argument_number_check(argc);
 	if (ret_val == ARG_COUNT_ERROR)
 		return (ARG_COUNT_ERROR);
@@ -174,5 +202,5 @@ t_return_value	parse_args(t_party *party, int argc, char **argv)
 		}
 		index++;
 	}
-	return (SUCCESS);
+	return (check_option_combinations(party));
 }
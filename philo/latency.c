@@ -0,0 +1,169 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   latency.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 21:03:17 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 21:03:17 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Sleeps and records how late the thread woke up.
+ *
+ * The lateness is the time slept beyond the requested duration, binned in
+ * LATENCY_BUCKET_WIDTH us buckets; the last bucket collects everything
+ * later. Each thread writes only its own histogram, so no locking is needed.
+ *
+ * @param histogram The thread's LATENCY_BUCKETS counters, or NULL without
+ * `--latency`, in which case this is a plain usleep.
+ * @param duration The time to sleep in us.
+ */
+void	measured_usleep(unsigned int *histogram, unsigned long long duration)
+{
+	unsigned long long	start_time;
+	unsigned long long	lateness;
+
+	if (histogram == NULL)
+	{
+		usleep(duration);
+		return ;
+	}
+	start_time = get_current_time();
+	usleep(duration);
+	lateness = get_current_time() - start_time;
+	if (lateness < duration)
+		lateness = duration;
+	lateness = (lateness - duration) / LATENCY_BUCKET_WIDTH;
+	if (lateness >= LATENCY_BUCKETS)
+		lateness = LATENCY_BUCKETS - 1;
+	histogram[lateness]++;
+}
+
+/**
+ * @brief Allocates the wakeup latency histograms of `--latency`.
+ *
+ * A single block holds one histogram per philosopher and a last one for the
+ * monitor. Without `--latency` every histogram pointer is NULL.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return t_return_value SUCCESS or MALLOC_FAIL
+ */
+t_return_value	prepare_latency(t_party *party)
+{
+	unsigned int	i;
+
+	if (party->options.latency)
+	{
+		party->latency = calloc((party->number_of_philosophers + 1)
+				* LATENCY_BUCKETS, sizeof(unsigned int));
+		if (party->latency == NULL)
+			return (MALLOC_FAIL);
+		party->monitor_latency = party->latency
+			+ party->number_of_philosophers * LATENCY_BUCKETS;
+	}
+	i = 0;
+	while (i < party->number_of_philosophers)
+	{
+		party->philosophers[i].latency = NULL;
+		if (party->latency != NULL)
+			party->philosophers[i].latency = party->latency
+				+ i * LATENCY_BUCKETS;
+		i++;
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @brief Finds the latency below which a share of the wakeups fall.
+ *
+ * @param histogram The LATENCY_BUCKETS counters.
+ * @param wakeups The total count of the histogram.
+ * @param permille The share of wakeups, in 1/1000.
+ * @return unsigned int The upper bound of the bucket reached, in us.
+ */
+static unsigned int	percentile(unsigned int *histogram,
+		unsigned long long wakeups, unsigned int permille)
+{
+	unsigned long long	seen;
+	unsigned int		bucket;
+
+	seen = 0;
+	bucket = 0;
+	while (bucket < LATENCY_BUCKETS - 1)
+	{
+		seen += histogram[bucket];
+		if (seen * 1000 >= wakeups * permille)
+			break ;
+		bucket++;
+	}
+	return ((bucket + 1) * LATENCY_BUCKET_WIDTH);
+}
+
+/**
+ * @brief Prints the percentiles and the decades of one histogram.
+ *
+ * @param name The threads the histogram belongs to.
+ * @param histogram The LATENCY_BUCKETS counters.
+ */
+static void	report_histogram(const char *name, unsigned int *histogram)
+{
+	unsigned long long	decades[5];
+	unsigned int		bucket;
+	unsigned long long	wakeups;
+
+	memset(decades, 0, sizeof(decades));
+	bucket = 0;
+	while (bucket < LATENCY_BUCKETS)
+	{
+		decades[(bucket * LATENCY_BUCKET_WIDTH >= 10)
+			+ (bucket * LATENCY_BUCKET_WIDTH >= 100)
+			+ (bucket * LATENCY_BUCKET_WIDTH >= 1000)
+			+ (bucket * LATENCY_BUCKET_WIDTH >= 5000)] += histogram[bucket];
+		bucket++;
+	}
+	wakeups = decades[0] + decades[1] + decades[2] + decades[3] + decades[4];
+	fprintf(stderr, "latency\t%s\twakeups %llu\tp50 %u us\tp99 %u us\t"
+		"p99.9 %u us\tmax %u us\n", name, wakeups,
+		percentile(histogram, wakeups, 500),
+		percentile(histogram, wakeups, 990),
+		percentile(histogram, wakeups, 999),
+		percentile(histogram, wakeups, 1000));
+	fprintf(stderr, "latency\t%s\t<10 us %llu\t<100 us %llu\t<1 ms %llu\t"
+		"<5 ms %llu\t>=5 ms %llu\n", name, decades[0], decades[1],
+		decades[2], decades[3], decades[4]);
+}
+
+/**
+ * @brief Prints how late the threads woke up from their sleeps, to stderr.
+ *
+ * With `--latency`, every sleep slice of the philosophers and every polling
+ * interval of the monitor is measured by `measured_usleep`. The histograms
+ * of the philosophers are merged; the monitor is reported on its own, as a
+ * late monitor delays the detection of a death.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ */
+void	report_latency(t_party *party)
+{
+	unsigned int	i;
+	unsigned int	bucket;
+
+	i = 1;
+	while (i < party->number_of_philosophers)
+	{
+		bucket = 0;
+		while (bucket < LATENCY_BUCKETS)
+		{
+			party->latency[bucket] += party->philosophers[i].latency[bucket];
+			bucket++;
+		}
+		i++;
+	}
+	report_histogram("philosophers", party->latency);
+	report_histogram("monitor", party->monitor_latency);
+}
@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   libphilo.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:58:14 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 13:58:14 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Checks a configuration with the same rules as the command-line.
+ *
+ * @param config A pointer to the t_philo_config struct to check.
+ * @return t_return_value SUCCESS, ARG_NOT_NUMERIC or TOO_MANY_PHILOS
+ */
+static t_return_value	validate_config(const t_philo_config *config)
+{
+	if (config == NULL || config->number_of_philosophers == 0
+		|| config->time_to_die == 0 || config->time_to_eat == 0
+		|| config->time_to_sleep == 0 || config->number_of_meals == 0
+		|| config->time_to_die > MAX_TIME_VALUE
+		|| config->time_to_eat > MAX_TIME_VALUE
+		|| config->time_to_sleep > MAX_TIME_VALUE)
+		return (ARG_NOT_NUMERIC);
+	if (config->number_of_philosophers > MAX_AMOUNT_PHILO_ALLOWED)
+		return (TOO_MANY_PHILOS);
+	return (SUCCESS);
+}
+
+/**
+ * @brief Fills a party from a configuration.
+ *
+ * Times are given in ms and kept in us, as `parse_args` does, and the 
+ * options that the configuration mirrors are set.
+ *
+ * @param party A pointer to the t_party struct to fill.
+ * @param config A pointer to the t_philo_config struct describing the party.
+ */
+static void	seat_guests(t_party *party, const t_philo_config *config)
+{
+	memset(party, 0, sizeof(t_party));
+	party->number_of_philosophers = config->number_of_philosophers;
+	party->time_to_die = config->time_to_die * 1000;
+	party->time_to_eat = config->time_to_eat * 1000;
+	party->time_to_sleep = config->time_to_sleep * 1000;
+	party->number_of_meals = config->number_of_meals;
+	party->options.scheduled = config->scheduled;
+	party->options.adaptive_think = config->adaptive_think;
+	party->options.edf = config->edf;
+	party->options.deadlock = config->deadlock;
+	party->options.stack_size = config->stack_size;
+	party->options.serial_spawn = config->serial_spawn;
+}
+
+/**
+ * @brief Creates and prepares a party from a configuration.
+ *
+ * The party is allocated, filled the same way `parse_args` fills it from the 
+ * command-line, and prepared with `prepare_party`. It does not start until 
+ * it is stepped or run. Events are printed to stdout unless a callback is 
+ * registered with `philo_party_set_callback`. If the preparation fails, 
+ * whatever it set up is released with `clean_up`.
+ *
+ * @param config A pointer to the t_philo_config struct describing the party.
+ * @return t_philo_party* The new party, or NULL if the configuration is 
+ * invalid or the preparation failed.
+ */
+t_philo_party	*philo_party_create(const t_philo_config *config)
+{
+	t_party	*party;
+
+	if (validate_config(config) != SUCCESS)
+		return (NULL);
+	party = malloc(sizeof(t_party));
+	if (party == NULL)
+		return (NULL);
+	seat_guests(party, config);
+	if (prepare_party(party) != SUCCESS)
+	{
+		clean_up(party);
+		free(party);
+		return (NULL);
+	}
+	return (party);
+}
+
+/**
+ * @brief Registers the callback receiving the events of a party.
+ *
+ * Must be called before the party is first stepped or run.
+ *
+ * @param party A pointer to the party.
+ * @param callback The function called for every event, or NULL to print the 
+ * events to stdout.
+ * @param user_data An opaque pointer handed back to the callback.
+ */
+void	philo_party_set_callback(t_philo_party *party,
+		t_philo_event_callback callback, void *user_data)
+{
+	party->event_callback = callback;
+	party->event_data = user_data;
+}
+
+/**
+ * @brief Ends a party if needed and releases all of its resources.
+ *
+ * A party still running is told that it is over and its threads are joined 
+ * before its mutexes are destroyed and its memory freed.
+ *
+ * @param party A pointer to the party, which must not be used afterwards.
+ */
+void	philo_party_destroy(t_philo_party *party)
+{
+	if (party == NULL)
+		return ;
+	if (party->started && party->joined == 0)
+	{
+		pthread_mutex_lock(&(party->dying));
+		party->someone_dead = 1;
+		pthread_mutex_unlock(&(party->dying));
+		party->joined = 1;
+		join_threads_to_exit_party(party);
+	}
+	clean_up(party);
+	free(party);
+}
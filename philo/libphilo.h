@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   libphilo.h                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:10:06 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 13:10:06 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LIBPHILO_H
+# define LIBPHILO_H
+
+/* ************************************************************************** */
+/*   Public API of the dining philosophers engine (libphilo.a / libphilo.so). */
+/*                                                                            */
+/*   Every party owns all of its state, so any number of parties can be       */
+/*   created and run concurrently from different threads of one process.     */
+/*   A given party must only be driven by one thread at a time.               */
+/* ************************************************************************** */
+
+/* ************************************************************************** */
+/*   Forward Declarations													  */
+/* ************************************************************************** */
+typedef struct s_party				t_philo_party;
+typedef struct s_philo_config		t_philo_config;
+typedef struct s_philo_event		t_philo_event;
+typedef struct s_philo_statistics	t_philo_statistics;
+
+/* ************************************************************************** */
+/*   Enum Definitions														  */
+/* ************************************************************************** */
+typedef enum e_philo_event_type
+{
+	PHILO_TOOK_FORK,
+	PHILO_EATING,
+	PHILO_SLEEPING,
+	PHILO_THINKING,
+	PHILO_DIED,
+}	t_philo_event_type;
+
+typedef enum e_philo_status
+{
+	PHILO_RUNNING,
+	PHILO_SOMEONE_DIED,
+	PHILO_EVERYONE_FED,
+	PHILO_FAILURE,
+	PHILO_DEADLOCKED,
+	PHILO_LIVELOCKED,
+}	t_philo_status;
+
+/* ************************************************************************** */
+/*   Struct Definitions														  */
+/* ************************************************************************** */
+
+/*
+ * Same parameters as the philo command-line, times in milliseconds.
+ * number_of_meals < 0 lets the party run until someone dies. The remaining
+ * fields mirror the --scheduled, --adaptive-think, --edf, --stack-size (in
+ * KiB, 0 for the default), --serial-spawn and --deadlock options.
+ */
+typedef struct s_philo_config
+{
+	unsigned int		number_of_philosophers;
+	unsigned long long	time_to_die;
+	unsigned long long	time_to_eat;
+	unsigned long long	time_to_sleep;
+	int					number_of_meals;
+	int					scheduled;
+	int					adaptive_think;
+	int					edf;
+	unsigned int		stack_size;
+	int					serial_spawn;
+	int					deadlock;
+}	t_philo_config;
+
+/*
+ * philosopher is 1-based, as in the log. description is the log text of the
+ * event ("has taken a fork", "is eating", ...).
+ */
+typedef struct s_philo_event
+{
+	unsigned long long	timestamp;
+	unsigned int		philosopher;
+	t_philo_event_type	type;
+	const char			*description;
+}	t_philo_event;
+
+typedef struct s_philo_statistics
+{
+	unsigned long long	total_meals;
+	double				duration;
+	double				meals_per_second;
+	double				meals_per_second_bound;
+	double				min_slack;
+	int					someone_died;
+	unsigned int		dead_philosopher;
+	unsigned long long	death_time;
+}	t_philo_statistics;
+
+/*
+ * Called for every event, serialized per party, from the party's threads.
+ * The callback must not call back into the same party.
+ */
+typedef void						(*t_philo_event_callback)(
+		const t_philo_event *event, void *user_data);
+
+/* ************************************************************************** */
+/*   Function Prototypes													  */
+/* ************************************************************************** */
+t_philo_party		*philo_party_create(const t_philo_config *config);
+void				philo_party_set_callback(t_philo_party *party,
+						t_philo_event_callback callback, void *user_data);
+t_philo_status		philo_party_step(t_philo_party *party,
+						unsigned long long duration);
+t_philo_status		philo_party_run(t_philo_party *party);
+int					philo_party_statistics(t_philo_party *party,
+						t_philo_statistics *statistics);
+void				philo_party_destroy(t_philo_party *party);
+
+#endif
@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   libphilo_run.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:16:39 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 14:16:39 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Checks if the monitoring thread has ended the party.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return int 1 if the party is over, 0 otherwise.
+ */
+static int	party_has_ended(t_party *party)
+{
+	int	someone_dead;
+
+	pthread_mutex_lock(&(party->dying));
+	someone_dead = party->someone_dead;
+	pthread_mutex_unlock(&(party->dying));
+	return (someone_dead != 0);
+}
+
+/**
+ * @brief Translates the outcome of an ended party into a public status.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return t_philo_status PHILO_SOMEONE_DIED, PHILO_EVERYONE_FED, 
+ * PHILO_DEADLOCKED, PHILO_LIVELOCKED or PHILO_FAILURE.
+ */
+static t_philo_status	party_status(t_party *party)
+{
+	if (party->outcome == SOMEONE_DIED)
+		return (PHILO_SOMEONE_DIED);
+	if (party->outcome == EVERYONE_IS_FED)
+		return (PHILO_EVERYONE_FED);
+	if (party->outcome == DEADLOCKED)
+		return (PHILO_DEADLOCKED);
+	if (party->outcome == LIVELOCKED)
+		return (PHILO_LIVELOCKED);
+	return (PHILO_FAILURE);
+}
+
+/**
+ * @brief Runs a party for at most a given duration.
+ *
+ * The first call starts the party. The calling thread then waits, checking 
+ * every millisecond, until the party ends or the duration has elapsed. Once 
+ * the party has ended, its threads are joined and its final status returned.
+ *
+ * @param party A pointer to the party.
+ * @param duration The longest time to wait, in milliseconds.
+ * @return t_philo_status PHILO_RUNNING if the duration elapsed first, the 
+ * final status of the party otherwise.
+ */
+t_philo_status	philo_party_step(t_philo_party *party,
+		unsigned long long duration)
+{
+	unsigned long long	start_time;
+
+	if (party->joined)
+		return (party_status(party));
+	if (party->started == 0 && start_dining_party(party) != SUCCESS)
+		return (PHILO_FAILURE);
+	start_time = get_current_time();
+	while (party_has_ended(party) == 0)
+	{
+		if ((get_current_time() - start_time) / 1000ULL >= duration)
+			return (PHILO_RUNNING);
+		usleep(1000);
+	}
+	party->joined = 1;
+	if (join_threads_to_exit_party(party) != SUCCESS)
+		party->outcome = JOIN_FAIL;
+	return (party_status(party));
+}
+
+/**
+ * @brief Runs a party until someone dies or everyone is fed.
+ *
+ * @param party A pointer to the party.
+ * @return t_philo_status The final status of the party.
+ */
+t_philo_status	philo_party_run(t_philo_party *party)
+{
+	t_philo_status	status;
+
+	status = PHILO_RUNNING;
+	while (status == PHILO_RUNNING)
+		status = philo_party_step(party, MAX_TIME_VALUE);
+	return (status);
+}
+
+/**
+ * @brief Reports the final statistics of a party.
+ *
+ * @param party A pointer to the party.
+ * @param statistics A pointer to the t_philo_statistics struct to fill.
+ * @return int 0 on success, -1 if the party has not ended yet.
+ */
+int	philo_party_statistics(t_philo_party *party,
+		t_philo_statistics *statistics)
+{
+	if (party->joined == 0 || party->outcome == LIFE_GOES_ON)
+		return (-1);
+	collect_statistics(party, statistics);
+	return (0);
+}
@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   livelock.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:02:37 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 19:02:37 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Finds the start of the latest meal of the table.
+ *
+ * @param party A pointer to the t_party struct.
+ * @return unsigned long long The latest time_last_ate, in us.
+ */
+static unsigned long long	latest_meal(t_party *party)
+{
+	unsigned int		i;
+	unsigned long long	latest;
+	unsigned long long	time_last_ate;
+
+	latest = 0;
+	i = 0;
+	while (i < party->number_of_philosophers)
+	{
+		pthread_mutex_lock(&(party->philosophers[i].meal_update));
+		time_last_ate = party->philosophers[i].time_last_ate;
+		pthread_mutex_unlock(&(party->philosophers[i].meal_update));
+		if (time_last_ate > latest)
+			latest = time_last_ate;
+		i++;
+	}
+	return (latest);
+}
+
+/**
+ * @brief Ends the party if nobody has eaten for the `--livelock` window.
+ *
+ * Philosophers that keep busy without any of them getting to eat are
+ * reported as soon as the window has passed, instead of time_to_die later.
+ * The window starts with the party.
+ *
+ * @param party A pointer to the t_party struct.
+ * @return t_return_value LIVELOCKED or LIFE_GOES_ON
+ */
+t_return_value	detect_livelock(t_party *party)
+{
+	unsigned long long	latest;
+	unsigned long long	curr_time;
+
+	if (party->options.livelock == 0)
+		return (LIFE_GOES_ON);
+	latest = latest_meal(party);
+	curr_time = get_current_time();
+	if (curr_time - latest < party->options.livelock * 1000ULL)
+		return (LIFE_GOES_ON);
+	pthread_mutex_lock(&(party->dying));
+	party->outcome = LIVELOCKED;
+	party->someone_dead = 1;
+	pthread_mutex_unlock(&(party->dying));
+	fprintf(stderr, "livelock\t%llu ms\tno meal since %llu ms\n",
+		(curr_time - party->party_start_time) / 1000ULL,
+		(latest - party->party_start_time) / 1000ULL);
+	return (LIVELOCKED);
+}
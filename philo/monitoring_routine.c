@@ -19,8 +19,12 @@
  * comparing the current time with the time the philosopher last ate. If the 
  * time since the philosopher's last meal exceeds the time_to_die value for 
  * the party, the philosopher is considered to have starved, and the function 
- * prints a death message. It returns SOMEONE_DIED if a philosopher has 
- * starved,otherwise LIFE_GOES_ON.
+ * records and reports the death. The current time is read after 
+ * time_last_ate so that a meal starting in between cannot make the 
+ * difference wrap around. In a segment of a `--segments` table, the death 
+ * is only printed if the coordinator grants it with `segment_claims_death`. 
+ * It returns SOMEONE_DIED if a philosopher has starved,otherwise 
+ * LIFE_GOES_ON.
  *
  * @param party A pointer to the t_party struct representing the party of 
  * philosophers.
@@ -32,21 +36,22 @@ static t_return_value	someone_starved(t_party *party)
 	unsigned int		i;
 	unsigned long long	curr_time;
 	unsigned long long	time_philo_last_ate;
-	unsigned long long	timestamp;
 
 	i = 0;
 	while (i < party->number_of_philosophers)
 	{
-		curr_time = get_current_time();
 		pthread_mutex_lock(&(party->philosophers[i].meal_update));
 		time_philo_last_ate = party->philosophers[i].time_last_ate;
 		pthread_mutex_unlock(&(party->philosophers[i].meal_update));
+		curr_time = get_current_time();
 		if (curr_time - time_philo_last_ate >= party->time_to_die)
 		{
 			pthread_mutex_lock(&(party->dying));
-			timestamp = get_current_time() - party->party_start_time;
-			timestamp /= 1000ULL;
-			printf("%llu\t%d\t%s\n", timestamp, i + 1, "died");
+			party->dead_philosopher = i;
+			party->death_time = get_current_time();
+			party->death_deadline = time_philo_last_ate + party->time_to_die;
+			if (segment_claims_death(party, i))
+				emit_event(party, i, PHILO_DIED);
 			return (SOMEONE_DIED);
 		}
 		i++;
@@ -63,7 +68,9 @@ static t_return_value	someone_starved(t_party *party)
  * number_of_meals is negative, it means the philosophers can eat infinitely, 
  * and the function returns LIFE_GOES_ON. If all philosophers have eaten the 
  * specified number of meals, it returns EVERYONE_IS_FED; otherwise, it 
- * returns LIFE_GOES_ON.
+ * returns LIFE_GOES_ON. A segment of a `--segments` table only reports 
+ * that its seats are fed to the coordinator, which ends the whole table 
+ * once every segment is.
  *
  * @param party A pointer to the t_party struct representing the party of 
  * philosophers.
@@ -87,32 +94,62 @@ static t_return_value	everyone_is_fed(t_party *party)
 			return (LIFE_GOES_ON);
 		i++;
 	}
+	if (party->segment.count > 1)
+		return (report_segment_fed(party));
 	return (EVERYONE_IS_FED);
 }
 
 /**
- * @brief Monitoring routine for the philosophers.
+ * @brief Checks if the party has already been ended.
  *
- * This function serves as a monitoring routine for the philosophers' party. 
- * It continuously checks if any philosopher has starved or if all 
- * philosophers have eaten the specified number of meals. If either of these 
- * conditions is met, it sets party->someone_dead to 1 and exits the loop. 
- * A delay of 500 us is used between each loop iteration.
- * 
- * @param party_data A pointer to the t_party struct representing the party 
- * of philosophers.
- * @return void* This function always returns NULL as it is intended to be 
- * used as a pthread routine.
+ * A segment of a `--segments` table is also ended when the coordinator 
+ * tells it to stop, see `segment_was_stopped`.
+ *
+ * @param party A pointer to the t_party struct representing the party of 
+ * philosophers.
+ * @return int 1 if party->someone_dead is already set, 0 otherwise.
  */
-void	*monitoring_routine(void *party_data)
+static int	party_was_ended(t_party *party)
 {
-	t_party	*party;
+	int	someone_dead;
 
-	party = (t_party *)party_data;
+	pthread_mutex_lock(&(party->dying));
+	someone_dead = party->someone_dead;
+	if (someone_dead == 0 && party->segment.count > 1
+		&& segment_was_stopped(party))
+		someone_dead = 1;
+	pthread_mutex_unlock(&(party->dying));
+	return (someone_dead != 0);
+}
+
+/**
+ * @brief Watches one party until it ends.
+ *
+ * Unless the party was ended from outside (e.g. a library user destroying 
+ * it early), this function continuously checks if any philosopher has 
+ * starved or if all philosophers have eaten the specified number of meals, 
+ * and ends the party early, with `--deadlock`, on a deadlock 
+ * (`detect_deadlock`) or, with `--livelock`, when nobody has eaten for too 
+ * long (`detect_livelock`). 
+ * If any of these conditions is met, it records the outcome, sets 
+ * party->someone_dead to 1, exits the loop and stamps the party's end time. 
+ * Between two checks it takes the snapshots of `--checkpoint` that are 
+ * due with `check_checkpoint`, then waits MONITOR_INTERVAL us.
+ *
+ * @param party A pointer to the t_party struct representing the party of 
+ * philosophers.
+ */
+static void	watch_party(t_party *party)
+{
 	while (1)
 	{
+		if (party_was_ended(party) || (party->options.deadlock
+				&& detect_deadlock(party) == DEADLOCKED)
+			|| detect_livelock(party) == LIVELOCKED)
+			break ;
 		if (someone_starved(party) == SOMEONE_DIED)
 		{
+			party->outcome = SOMEONE_DIED;
 			party->someone_dead = 1;
 			pthread_mutex_unlock(&(party->dying));
 			break ;
@@ -120,11 +157,55 @@ void	*monitoring_routine(void *party_data)
 		if (everyone_is_fed(party) == EVERYONE_IS_FED)
 		{
 			pthread_mutex_lock(&(party->dying));
+			party->outcome = EVERYONE_IS_FED;
 			party->someone_dead = 1;
 			pthread_mutex_unlock(&(party->dying));
 			break ;
 		}
-		usleep(700);
+		check_checkpoint(party);
+		measured_usleep(party->monitor_latency, MONITOR_INTERVAL);
+	}
+	party->party_end_time = get_current_time();
+}
+
+/**
+ * @brief Monitoring routine for the philosophers.
+ *
+ * This function serves as a monitoring routine for the philosophers' party 
+ * and watches it with `watch_party`. With `--repeat K`, the monitor watches 
+ * K parties in a row, meeting the other threads at the party's rendezvous 
+ * barrier before and after each of them. With `--cpu-stats`, the CPU time 
+ * of a single party's monitor is accounted. With `--realtime` or 
+ * `--monitor-core`, the monitor first takes its priority and core with 
+ * `raise_monitor`.
+ * 
+ * @param party_data A pointer to the t_party struct representing the party 
+ * of philosophers.
+ * @return void* This function always returns NULL as it is intended to be 
+ * used as a pthread routine.
+ */
+void	*monitoring_routine(void *party_data)
+{
+	t_party			*party;
+	unsigned int	run;
+
+	party = (t_party *)party_data;
+	raise_monitor(party);
+	if (party->options.repeat <= 1)
+	{
+		cpu_start(&(party->monitor_cpu), party->options.cpu_stats,
+			CPU_MONITORING);
+		watch_party(party);
+		cpu_stop(&(party->monitor_cpu));
+		return (NULL);
+	}
+	run = 0;
+	while (run < party->options.repeat)
+	{
+		barrier_wait(&(party->rendezvous));
+		watch_party(party);
+		barrier_wait(&(party->rendezvous));
+		run++;
 	}
 	return (NULL);
 }
@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   option_checks.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 20:05:16 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 20:05:16 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Tells if snapshots are taken or restored.
+ *
+ * @param options A pointer to the `t_options` struct.
+ * @return int 1 if `--checkpoint`, `--checkpoint-at` or `--restore` is set,
+ * 0 otherwise.
+ */
+static int	uses_checkpoints(t_options *options)
+{
+	return (options->checkpoint_at || options->checkpoint_file != NULL
+		|| options->restore_file != NULL);
+}
+
+/**
+ * @brief Tells if an option needs the whole table in one process.
+ *
+ * The scheduled, adaptive-think, edf, repeat, livelock and deadlock modes, 
+ * as well as the realtime settings, the latency histogram, the injected 
+ * disturbances and the snapshots, act on the threads of a single process.
+ *
+ * @param options A pointer to the `t_options` struct.
+ * @return int 1 if such an option is set, 0 otherwise.
+ */
+static int	needs_one_process(t_options *options)
+{
+	return (options->scheduled || options->adaptive_think || options->edf
+		|| options->repeat > 1 || options->livelock || options->deadlock
+		|| options->realtime
+		|| options->monitor_core || options->latency || options->jitter
+		|| options->burners || options->backpressure
+		|| uses_checkpoints(options));
+}
+
+/**
+ * @brief Checks that the options fit the table and each other.
+ *
+ * Every segment of `--segments P` needs at least one seat. The options of 
+ * `needs_one_process` cannot be combined with `--segments` or 
+ * `--processes`, which cannot be combined with each other either. 
+ * `--cpu-stats` accounts the threads of a single party, and so do the 
+ * snapshots, which do not record the rounds of the scheduled mode. These 
+ * options are all known, so a conflict gets its own CONFLICTING_OPTIONS 
+ * rather than the UNKNOWN_OPTION of a misspelled option.
+ *
+ * @param party A pointer to the `t_party` struct holding the arguments.
+ * @return t_return_value SUCCESS or CONFLICTING_OPTIONS
+ */
+t_return_value	check_option_combinations(t_party *party)
+{
+	if (party->options.segments > party->number_of_philosophers)
+		printf("Option --segments expects at most one segment per "
+			"philosopher\n\n");
+	else if ((party->options.segments > 1 || party->options.processes)
+		&& needs_one_process(&(party->options)))
+		printf("Options --segments and --processes cannot be combined with "
+			"--scheduled, --adaptive-think, --edf, --repeat, --livelock, "
+			"--deadlock, "
+			"--realtime, --monitor-core, --latency, --jitter, --burners, "
+			"--backpressure, --checkpoint, --checkpoint-at or --restore\n\n");
+	else if (party->options.segments > 1 && party->options.processes)
+		printf("Options --segments and --processes cannot be combined\n\n");
+	else if (party->options.cpu_stats && (party->options.repeat > 1
+			|| party->options.segments > 1 || party->options.processes))
+		printf("Option --cpu-stats cannot be combined with --repeat, "
+			"--segments or --processes\n\n");
+	else if (uses_checkpoints(&(party->options)) && (party->options.scheduled
+			|| party->options.repeat > 1))
+		printf("Snapshots cannot be taken or restored with --scheduled or "
+			"--repeat\n\n");
+	else
+		return (SUCCESS);
+	return (CONFLICTING_OPTIONS);
+}
@@ -0,0 +1,197 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:41 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 09:12:41 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Compares two strings for equality.
+ *
+ * @param first The first NUL-terminated string.
+ * @param second The second NUL-terminated string.
+ * @return int 1 if both strings are identical, 0 otherwise.
+ */
+static int	strings_match(const char *first, const char *second)
+{
+	while (*first != '\0' && *first == *second)
+	{
+		first++;
+		second++;
+	}
+	return (*first == *second);
+}
+
+/**
+ * @brief Stores an option expecting a strictly positive numeric value.
+ *
+ * @param option The command-line option string, used in error messages.
+ * @param value The next command-line argument, or NULL if there is none.
+ * @param destination Where to store the validated value.
+ * @return t_return_value SUCCESS or ARG_NOT_NUMERIC
+ */
+static t_return_value	store_option_value(const char *option,
+		const char *value, unsigned int *destination)
+{
+	unsigned long long	validated_value;
+
+	validated_value = 0;
+	if (value != NULL)
+		validated_value = ascii_to_positive_int(value);
+	if (validated_value == 0 || validated_value > 1000000)
+	{
+		printf("Option %s expects a positive number\n\n", option);
+		return (ARG_NOT_NUMERIC);
+	}
+	*destination = (unsigned int)validated_value;
+	return (SUCCESS);
+}
+
+/**
+ * @brief Stores the CPU number of `--monitor-core`.
+ *
+ * CPU 0 is a valid choice, so the core is stored as C + 1 and 0 means that
+ * no core was asked for.
+ *
+ * @param value The next command-line argument, or NULL if there is none.
+ * @param destination Where to store the CPU number plus one.
+ * @return t_return_value SUCCESS or ARG_NOT_NUMERIC
+ */
+static t_return_value	store_core_option(const char *value,
+		unsigned int *destination)
+{
+	unsigned long long	core;
+
+	core = 0;
+	if (value != NULL)
+		core = ascii_to_positive_int(value);
+	if (value == NULL || (core == 0 && strings_match(value, "0") == 0)
+		|| core >= 1000000)
+	{
+		printf("Option --monitor-core expects a CPU number\n\n");
+		return (ARG_NOT_NUMERIC);
+	}
+	*destination = (unsigned int)core + 1;
+	return (SUCCESS);
+}
+
+/**
+ * @brief Stores a single `--option` in the party's options.
+ *
+ * Options are switches that toggle an alternative behaviour of the
+ * simulation; a few of them take the next argument as their value, in which
+ * case index is advanced past it. Unknown options are reported and rejected
+ * with UNKNOWN_OPTION.
+ *
+ * @param party A pointer to the `t_party` struct holding the options.
+ * @param argv An array of strings containing the command-line arguments.
+ * @param index A pointer to the position of the option in argv.
+ * @return t_return_value SUCCESS, ARG_NOT_NUMERIC or UNKNOWN_OPTION
+ */
+static t_return_value	store_option(t_party *party, char **argv, int *index)
+{
+	const char	*option;
+
+	option = argv[*index];
+	if (strings_match(option, "--scheduled"))
+		party->options.scheduled = 1;
+	else if (strings_match(option, "--stats"))
+		party->options.stats = 1;
+	else if (strings_match(option, "--cpu-stats"))
+		party->options.cpu_stats = 1;
+	else if (strings_match(option, "--realtime"))
+		party->options.realtime = 1;
+	else if (strings_match(option, "--latency"))
+		party->options.latency = 1;
+	else if (strings_match(option, "--monitor-core"))
+		return (store_core_option(argv[++(*index)],
+				&(party->options.monitor_core)));
+	else if (strings_match(option, "--adaptive-think"))
+		party->options.adaptive_think = 1;
+	else if (strings_match(option, "--edf"))
+		party->options.edf = 1;
+	else if (strings_match(option, "--serial-spawn"))
+		party->options.serial_spawn = 1;
+	else if (strings_match(option, "--processes"))
+		party->options.processes = 1;
+	else if (strings_match(option, "--repeat"))
+		return (store_option_value(option, argv[++(*index)],
+				&(party->options.repeat)));
+	else if (strings_match(option, "--stack-size"))
+		return (store_option_value(option, argv[++(*index)],
+				&(party->options.stack_size)));
+	else if (strings_match(option, "--segments"))
+		return (store_option_value(option, argv[++(*index)],
+				&(party->options.segments)));
+	else if (strings_match(option, "--livelock"))
+		return (store_option_value(option, argv[++(*index)],
+				&(party->options.livelock)));
+	else if (strings_match(option, "--deadlock"))
+		party->options.deadlock = 1;
+	else if (strings_match(option, "--jitter"))
+		return (store_option_value(option, argv[++(*index)],
+				&(party->options.jitter)));
+	else if (strings_match(option, "--burners"))
+		return (store_option_value(option, argv[++(*index)],
+				&(party->options.burners)));
+	else if (strings_match(option, "--checkpoint-at"))
+		return (store_option_value(option, argv[++(*index)],
+				&(party->options.checkpoint_at)));
+	else if (strings_match(option, "--checkpoint") && argv[*index + 1])
+		party->options.checkpoint_file = argv[++(*index)];
+	else if (strings_match(option, "--restore") && argv[*index + 1])
+		party->options.restore_file = argv[++(*index)];
+	else if (strings_match(option, "--backpressure"))
+		return (store_option_value(option, argv[++(*index)],
+				&(party->options.backpressure)));
+	else
+	{
+		printf("Unknown option: %s\n\n", option);
+		return (UNKNOWN_OPTION);
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @brief Extracts the `--option` arguments from the command-line.
+ *
+ * This function resets the party's options, stores every argument starting
+ * with `--` (and its value, if any) using `store_option` and compacts the
+ * remaining positional arguments at the front of argv, updating argc
+ * accordingly, so that the positional parsing done by `parse_args` is
+ * unaffected by options.
+ *
+ * @param party A pointer to the `t_party` struct holding the options.
+ * @param argc A pointer to the number of command-line arguments.
+ * @param argv An array of strings containing the command-line arguments.
+ * @return t_return_value SUCCESS or UNKNOWN_OPTION
+ */
+t_return_value	parse_options(t_party *party, int *argc, char **argv)
+{
+	int	index;
+	int	kept;
+
+	memset(&(party->options), 0, sizeof(t_options));
+	index = 1;
+	kept = 1;
+	while (index < *argc)
+	{
+		if (argv[index][0] == '-' && argv[index][1] == '-')
+		{
+			if (store_option(party, argv, &index) != SUCCESS)
+				return (UNKNOWN_OPTION);
+		}
+		else
+			argv[kept++] = argv[index];
+		index++;
+	}
+	*argc = kept;
+	return (SUCCESS);
+}
@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parties.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 23:55:40 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 23:55:40 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "parties.h"
+
+/**
+ * @brief Counts the events of one party.
+ *
+ * Events of a philosopher outside the party's table are counted as 
+ * strangers: they would mean that two parties share some state.
+ *
+ * @param event The event, as logged.
+ * @param user_data A pointer to the t_guest_party of the party.
+ */
+static void	count_event(const t_philo_event *event, void *user_data)
+{
+	t_guest_party	*guest;
+
+	guest = (t_guest_party *)user_data;
+	guest->events++;
+	if (event->type == PHILO_EATING)
+		guest->meals_logged++;
+	if (event->philosopher == 0
+		|| event->philosopher > guest->config.number_of_philosophers)
+		guest->strangers++;
+}
+
+/**
+ * @brief Runs one party to its end, from its own thread.
+ *
+ * @param guest_data A pointer to the t_guest_party to run.
+ * @return void* Always NULL.
+ */
+static void	*run_party(void *guest_data)
+{
+	t_guest_party	*guest;
+
+	guest = (t_guest_party *)guest_data;
+	guest->status = PHILO_FAILURE;
+	if (guest->party != NULL)
+		guest->status = philo_party_run(guest->party);
+	return (NULL);
+}
+
+/**
+ * @brief Creates one party of the example and runs it from its own thread.
+ *
+ * Every party eats and sleeps PARTY_EAT and PARTY_SLEEP ms. A party with no 
+ * meal count is expected to starve, the others to be fed.
+ *
+ * @param guest A pointer to the t_guest_party to set up.
+ * @param seats The number of philosophers.
+ * @param die The time to die in ms.
+ * @param meals The number of meals, or -1 to run until someone dies.
+ * @param mode 1 for the --scheduled mode, 2 for --edf, 0 for neither.
+ */
+static void	seat_party(t_guest_party *guest, unsigned int seats,
+		unsigned long long die, int meals, int mode)
+{
+	guest->config.number_of_philosophers = seats;
+	guest->config.time_to_die = die;
+	guest->config.time_to_eat = PARTY_EAT;
+	guest->config.time_to_sleep = PARTY_SLEEP;
+	guest->config.number_of_meals = meals;
+	guest->config.scheduled = (mode == 1);
+	guest->config.edf = (mode == 2);
+	guest->expected = PHILO_EVERYONE_FED;
+	if (meals < 0)
+		guest->expected = PHILO_SOMEONE_DIED;
+	guest->party = philo_party_create(&(guest->config));
+	if (guest->party != NULL)
+		philo_party_set_callback(guest->party, count_event, guest);
+	guest->started = (pthread_create(&(guest->thread), NULL, run_party,
+				guest) == 0);
+}
+
+/**
+ * @brief Prints the outcome of one party and checks it.
+ *
+ * A party passes if it ended as expected, no event of another party reached 
+ * its callback and its statistics count no more meals than it logged.
+ *
+ * @param guest A pointer to the t_guest_party that ended.
+ * @param index The index of the party.
+ * @return int 0 if the party passes, 1 otherwise.
+ */
+static int	check_party(t_guest_party *guest, unsigned int index)
+{
+	static const char	*names[] = {"running", "someone died", "everyone fed",
+		"failure", "deadlocked", "livelocked"};
+	t_philo_statistics	statistics;
+	int					failed;
+
+	memset(&statistics, 0, sizeof(statistics));
+	failed = (guest->status != guest->expected || guest->strangers != 0);
+	if (guest->party == NULL
+		|| philo_party_statistics(guest->party, &statistics) != 0
+		|| statistics.total_meals > guest->meals_logged)
+		failed = 1;
+	printf("party %u\tseats %u\t%s (expected %s)\tevents %llu\tmeals %llu\t"
+		"meals/s %.2f\tbound %.2f\n", index,
+		guest->config.number_of_philosophers, names[guest->status],
+		names[guest->expected], guest->events, statistics.total_meals,
+		statistics.meals_per_second, statistics.meals_per_second_bound);
+	if (failed)
+		printf("party %u\tFAILED\n", index);
+	philo_party_destroy(guest->party);
+	return (failed);
+}
+
+/**
+ * @brief Runs several parties of libphilo concurrently in one process.
+ *
+ * Each party runs from its own thread, at the same time as the others. The 
+ * exit status is 1 if any party fails its checks.
+ *
+ * @return int 0 if every party passes, 1 otherwise.
+ */
+int	main(void)
+{
+	t_guest_party	parties[PARTIES];
+	unsigned int	i;
+	int				failures;
+
+	memset(parties, 0, sizeof(parties));
+	seat_party(&parties[0], 5, 800, 5, 0);
+	seat_party(&parties[1], 4, 150, -1, 0);
+	seat_party(&parties[2], 31, 800, 5, 1);
+	seat_party(&parties[3], 200, 800, 5, 2);
+	i = 0;
+	failures = 0;
+	while (i < PARTIES)
+	{
+		if (parties[i].started)
+			pthread_join(parties[i].thread, NULL);
+		failures += check_party(&parties[i], i);
+		i++;
+	}
+	return (failures != 0);
+}
@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parties.h                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 23:55:40 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 23:55:40 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PARTIES_H
+# define PARTIES_H
+
+# include <pthread.h>
+# include <stdio.h>
+# include <string.h>
+# include "libphilo.h"
+
+/* ************************************************************************** */
+/*   Define Constants														  */
+/* ************************************************************************** */
+# define PARTIES 4
+# define PARTY_EAT 100
+# define PARTY_SLEEP 100
+
+/* ************************************************************************** */
+/*   Struct Definitions														  */
+/* ************************************************************************** */
+
+/*
+ * One of the parties run side by side by philo_parties, with the outcome it
+ * is expected to end with and what its event callback counted. The callback
+ * of a party is serialized, so the counts need no lock.
+ */
+typedef struct s_guest_party
+{
+	t_philo_config		config;
+	t_philo_party		*party;
+	pthread_t			thread;
+	int					started;
+	t_philo_status		expected;
+	t_philo_status		status;
+	unsigned long long	events;
+	unsigned long long	meals_logged;
+	unsigned int		strangers;
+}	t_guest_party;
+
+#endif
@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   party_locks.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 23:48:12 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 23:48:12 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Initializes the locks shared by the whole table.
+ *
+ * The guard, dying and scheduling mutexes and the rendezvous barrier of the 
+ * philosophers, the monitor and the main thread are initialized in this 
+ * order, and party->prepared.locks counts those that were.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return t_return_value SUCCESS or MUTEX_FAIL
+ */
+t_return_value	initialize_table_locks(t_party *party)
+{
+	if (pthread_mutex_init(&(party->guard), NULL) != SUCCESS)
+		return (MUTEX_FAIL);
+	party->prepared.locks++;
+	if (pthread_mutex_init(&(party->dying), NULL) != SUCCESS)
+		return (MUTEX_FAIL);
+	party->prepared.locks++;
+	if (pthread_mutex_init(&(party->scheduling), NULL) != SUCCESS)
+		return (MUTEX_FAIL);
+	party->prepared.locks++;
+	if (barrier_init(&(party->rendezvous), party->number_of_philosophers + 2)
+		!= SUCCESS)
+		return (MUTEX_FAIL);
+	party->prepared.locks++;
+	return (SUCCESS);
+}
+
+/**
+ * @brief Destroys the locks of the table counted in party->prepared.locks.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ */
+static void	destroy_table_locks(t_party *party)
+{
+	if (party->prepared.locks > 3)
+		barrier_destroy(&(party->rendezvous));
+	if (party->prepared.locks > 2)
+		pthread_mutex_destroy(&(party->scheduling));
+	if (party->prepared.locks > 1)
+		pthread_mutex_destroy(&(party->dying));
+	if (party->prepared.locks > 0)
+		pthread_mutex_destroy(&(party->guard));
+	party->prepared.locks = 0;
+}
+
+/**
+ * @brief Destroys every lock of the party that was initialized.
+ *
+ * The forks and the philosophers' meal_update mutexes counted in 
+ * party->prepared are destroyed, then the locks of the table, so that a 
+ * party whose preparation failed halfway is released as well as a 
+ * finished one.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ */
+void	destroy_party_locks(t_party *party)
+{
+	t_fork	*fork;
+
+	while (party->prepared.forks > 0)
+	{
+		party->prepared.forks--;
+		fork = &(party->forks[party->prepared.forks]);
+		pthread_mutex_destroy(&(fork->lock));
+		pthread_mutex_destroy(&(fork->arbiter));
+		pthread_cond_destroy(&(fork->handed_over));
+	}
+	while (party->prepared.seats > 0)
+	{
+		party->prepared.seats--;
+		pthread_mutex_destroy(
+			&(party->philosophers[party->prepared.seats].meal_update));
+	}
+	destroy_table_locks(party);
+}
@@ -16,7 +16,8 @@
  * @brief Prepares a philosopher for the party.
  *
  * This function prepares an individual philosopher for the party. It sets up 
- * the philosopher's own fork and the borrowed fork, initializes the meal 
+ * the philosopher's own fork and the borrowed fork, which is the extra 
+ * remote fork for the last seat of a segment, initializes the meal 
  * count to 0, and sets the party pointer for the philosopher. It also 
  * initializes the meal_update mutex for the philosopher. If the mutex 
  * initialization fails, the function returns MUTEX_FAIL; otherwise, it 
@@ -33,8 +34,19 @@ static t_return_value	prepare_philosopher(t_party *party, unsigned int i)
 {
 	party->philosophers[i].fork_own = &party->forks[i];
 	party->philosophers[i].fork_borrowed = &party->forks[(i + 1)
-		% party->number_of_philosophers];
+		% party->number_of_forks];
+	party->philosophers[i].index = i;
+	party->philosophers[i].thread_started = 0;
 	party->philosophers[i].meal_count = 0;
+	party->philosophers[i].min_slack = (long long)party->time_to_die;
+	party->philosophers[i].next_round = 0;
+	party->philosophers[i].waiting_for = NULL;
+	party->philosophers[i].stuck_since = 0;
+	party->philosophers[i].activity = PHILO_THINKING;
+	party->philosophers[i].forks_held = 0;
+	party->philosophers[i].activity_meals = 0;
+	party->philosophers[i].jitter_seed = (unsigned int)(get_current_time()
+			^ (i * 2654435761U));
 	party->philosophers[i].party = party;
 	if (pthread_mutex_init(&(party->philosophers[i].meal_update),
 			NULL) != SUCCESS)
@@ -42,14 +54,50 @@ static t_return_value	prepare_philosopher(t_party *party, unsigned int i)
 	return (SUCCESS);
 }
 
+/**
+ * @brief Initializes a fork.
+ *
+ * This function initializes the fork's own mutex, used when forks are 
+ * plain mutexes, as well as the arbiter mutex, the condition variable and 
+ * the empty waiter queue used by the `--edf` arbitration. The fork is local 
+ * until a segment links it to its neighbouring process. If any 
+ * initialization fails, whatever the function initialized is destroyed and 
+ * it returns MUTEX_FAIL; otherwise, it returns SUCCESS.
+ *
+ * @param fork A pointer to the t_fork struct to initialize.
+ * @return t_return_value SUCCESS or MUTEX_FAIL
+ */
+static t_return_value	initialize_fork(t_fork *fork)
+{
+	fork->holder = NULL;
+	fork->waiter_count = 0;
+	fork->remote = -1;
+	if (pthread_mutex_init(&(fork->lock), NULL) != SUCCESS)
+		return (MUTEX_FAIL);
+	if (pthread_mutex_init(&(fork->arbiter), NULL) != SUCCESS)
+	{
+		pthread_mutex_destroy(&(fork->lock));
+		return (MUTEX_FAIL);
+	}
+	if (pthread_cond_init(&(fork->handed_over), NULL) != SUCCESS)
+	{
+		pthread_mutex_destroy(&(fork->lock));
+		pthread_mutex_destroy(&(fork->arbiter));
+		return (MUTEX_FAIL);
+	}
+	return (SUCCESS);
+}
+
 /**
  * @brief Initializes the mutexes for the party.
  *
  * This function initializes all the necessary mutexes for the party, 
  * including the mutexes for individual philosophers' meal_update and forks, 
- * as well as the guard and dying mutexes for synchronization purposes. If 
- * any mutex initialization fails, the function returns MUTEX_FAIL; 
- * otherwise, it returns SUCCESS.
+ * then the guard, dying and scheduling mutexes and the rendezvous barrier 
+ * with initialize_table_locks. What is initialized is counted in 
+ * party->prepared, so that clean_up destroys exactly that even if a later 
+ * initialization fails. If any mutex initialization fails, the function 
+ * returns MUTEX_FAIL; otherwise, it returns SUCCESS.
  *
  * @param party A pointer to the t_party struct representing the party of 
  * philosophers.
@@ -58,38 +106,83 @@ static t_return_value	prepare_philosopher(t_party *party, unsigned int i)
  */
 static t_return_value	initialize_mutexes(t_party *party)
 {
-	unsigned int	i;
+	t_prepared	*prepared;
 
-	i = 0;
-	while (i < party->number_of_philosophers)
+	prepared = &(party->prepared);
+	while (prepared->seats < party->number_of_philosophers)
 	{
-		if (prepare_philosopher(party, i) != SUCCESS)
+		if (prepare_philosopher(party, prepared->seats) != SUCCESS)
 			return (MUTEX_FAIL);
-		i++;
+		prepared->seats++;
 	}
-	i = 0;
-	while (i < party->number_of_philosophers)
+	while (prepared->forks < party->number_of_forks)
 	{
-		if (pthread_mutex_init(&(party->forks[i]), NULL) != SUCCESS)
+		if (initialize_fork(&(party->forks[prepared->forks])) != SUCCESS)
 			return (MUTEX_FAIL);
-		i++;
+		prepared->forks++;
 	}
-	if (pthread_mutex_init(&(party->guard), NULL) != SUCCESS)
-		return (MUTEX_FAIL);
-	if (pthread_mutex_init(&(party->dying), NULL) != SUCCESS)
-		return (MUTEX_FAIL);
-	return (SUCCESS);
+	return (initialize_table_locks(party));
+}
+
+/**
+ * @brief Resets the run state of the party.
+ *
+ * This function clears the flags and results describing the progress of the 
+ * party, so that it can be started, stepped and queried from its very 
+ * beginning. No event callback is registered: events are printed to stdout. 
+ * The party is a whole table until `run_segmented_table` makes it a segment. 
+ * Nothing is counted as initialized in party->prepared yet.
+ *
+ * @param party A pointer to the t_party struct representing the party of 
+ * philosophers.
+ */
+static void	initialize_party_state(t_party *party)
+{
+	party->someone_dead = 0;
+	party->schedule = NULL;
+	party->latency = NULL;
+	party->monitor_latency = NULL;
+	party->realtime_active = 0;
+	party->disturbance.active = 0;
+	party->checkpoint = NULL;
+	party->restored = NULL;
+	party->checkpoint_taken = 0;
+	party->threads_started = 0;
+	party->threads_reported = 0;
+	party->started = 0;
+	party->joined = 0;
+	memset(&(party->prepared), 0, sizeof(t_prepared));
+	party->outcome = LIFE_GOES_ON;
+	party->party_end_time = 0;
+	party->event_callback = NULL;
+	party->event_data = NULL;
+	party->segment.index = 0;
+	party->segment.count = 1;
+	party->segment.first_seat = 0;
+	party->segment.control = -1;
+	party->segment.fork_server = -1;
+	party->segment.server_started = 0;
+	party->segment.fed_reported = 0;
 }
 
 /**
  * @brief Prepares the party of philosophers.
  *
- * This function prepares the whole party of philosophers. It initializes the 
- * party's someone_dead flag to 0 and allocates memory for the philosophers 
- * and forks arrays. It then calls initialize_mutexes to set up all the 
- * necessary mutexes. If any memory allocation or mutex initialization fails, 
- * the function returns MALLOC_FAIL or MUTEX_FAIL respectively; otherwise, it 
- * returns SUCCESS.
+ * This function prepares the whole party of philosophers. It resets the 
+ * party's run state using initialize_party_state and allocates memory for 
+ * the philosophers and forks arrays, with one extra fork standing for the 
+ * neighbouring segment's fork with `--segments`. It then calls 
+ * initialize_mutexes to set up all the necessary mutexes, and 
+ * prepare_thread_spawning to set up the thread attributes. In scheduled 
+ * mode it also precomputes the eating rounds using prepare_schedule. With 
+ * `--latency` it allocates the wakeup histograms using prepare_latency, and 
+ * with `--realtime` or `--monitor-core` it tunes the scheduling with 
+ * enter_realtime before any thread is created. It then prepares the 
+ * snapshots of `--checkpoint` and loads the one of `--restore` with 
+ * prepare_checkpoint, which returns ERROR if it cannot be restored. If any 
+ * memory allocation, mutex or thread attribute initialization fails, the 
+ * function returns MALLOC_FAIL, MUTEX_FAIL or THREAD_FAIL respectively; 
+ * otherwise, it returns SUCCESS.
  *
  * @param party A pointer to the t_party struct representing the party of 
  * philosophers.
@@ -98,16 +191,27 @@ static t_return_value	initialize_mutexes(t_party *party)
  */
 t_return_value	prepare_party(t_party *party)
 {
-	party->someone_dead = 0;
+	initialize_party_state(party);
+	party->number_of_forks = party->number_of_philosophers
+		+ (party->options.segments > 1);
+	party->forks = NULL;
+	party->deadlock_suspect = 0;
 	party->philosophers = malloc(sizeof(t_philosopher) * \
 			party->number_of_philosophers);
 	if (party->philosophers == NULL)
 		return (MALLOC_FAIL);
-	party->forks = malloc(sizeof(pthread_mutex_t) * \
-			party->number_of_philosophers);
+	party->forks = malloc(sizeof(t_fork) * \
+			party->number_of_forks);
 	if (party->forks == NULL)
 		return (MALLOC_FAIL);
 	if (initialize_mutexes(party) == MUTEX_FAIL)
 		return (MUTEX_FAIL);
-	return (SUCCESS);
+	if (prepare_thread_spawning(party) != SUCCESS)
+		return (THREAD_FAIL);
+	if (party->options.scheduled && prepare_schedule(party) != SUCCESS)
+		return (MALLOC_FAIL);
+	if (prepare_latency(party) != SUCCESS)
+		return (MALLOC_FAIL);
+	enter_realtime(party);
+	return (prepare_checkpoint(party));
 }
@@ -12,17 +12,57 @@
 
 #include "philosophers.h"
 
+/**
+ * @brief Picks up both forks and eats for time_to_eat.
+ *
+ * The philosopher picks up their own fork and the borrowed fork, stamps the
+ * start of the meal, eats for a specified time, releases both forks and
+ * updates the meal count. If the party ends while they wait for a fork, the
+ * fork already held is put back and SOMEONE_DIED is returned. With
+ * `--jitter`, a random pause delays the reach for the forks.
+ *
+ * @param philosopher A pointer to the t_philosopher struct representing the 
+ * philosopher.
+ * @return t_return_value SUCCESS or SOMEONE_DIED
+ */
+static t_return_value	eat(t_philosopher *philosopher)
+{
+	if (philosopher->party->options.jitter)
+		custom_usleep(0, philosopher);
+	cpu_phase(&(philosopher->cpu), CPU_FORK_WAIT);
+	if (take_fork(philosopher, philosopher->fork_own) != SUCCESS)
+		return (SOMEONE_DIED);
+	print_whats_happening(philosopher, PHILO_TOOK_FORK);
+	if (take_fork(philosopher, philosopher->fork_borrowed) != SUCCESS)
+	{
+		release_fork(philosopher, philosopher->fork_own);
+		return (SOMEONE_DIED);
+	}
+	print_whats_happening(philosopher, PHILO_TOOK_FORK);
+	pthread_mutex_lock(&philosopher->meal_update);
+	record_meal_start(philosopher);
+	pthread_mutex_unlock(&philosopher->meal_update);
+	cpu_phase(&(philosopher->cpu), CPU_EATING);
+	print_whats_happening(philosopher, PHILO_EATING);
+	custom_usleep(philosopher->party->time_to_eat, philosopher);
+	release_fork(philosopher, philosopher->fork_own);
+	release_fork(philosopher, philosopher->fork_borrowed);
+	pthread_mutex_lock(&philosopher->meal_update);
+	philosopher->meal_count++;
+	pthread_mutex_unlock(&philosopher->meal_update);
+	return (SUCCESS);
+}
+
 /**
  * @brief Performs the eat-sleep-think routine for a philosopher.
  *
  * This function represents the routine of a philosopher's life where they go 
  * through the process of eating, sleeping, and thinking. If there is only 
- * one philosopher in the party, it returns SINGLE_PHILO_CASE immediately. 
- * Otherwise, the philosopher attempts to pick up their own fork and the 
- * borrowed fork, then proceeds to eat for a specified time. After eating, 
- * the philosopher releases both forks, updates the meal count, and goes to 
- * sleep for a specified time. Finally, the philosopher prints that they are 
- * thinking and returns SUCCESS.
+ * one fork on the table, it returns SINGLE_PHILO_CASE immediately. 
+ * In scheduled mode the philosopher first waits for a round of the
+ * precomputed schedule that includes their seat. The philosopher then eats,
+ * goes to sleep for a specified time and prints that they are thinking. With
+ * `--adaptive-think` they also `think` before returning SUCCESS.
  *
  * @param philosopher A pointer to the t_philosopher struct representing the 
  * philosopher.
@@ -31,62 +71,62 @@
  */
 static t_return_value	eat_sleep_think(t_philosopher *philosopher)
 {
-	if (philosopher->party->number_of_philosophers == 1)
+	t_party	*party;
+
+	party = philosopher->party;
+	if (party->number_of_forks == 1)
 		return (SINGLE_PHILO_CASE);
-	pthread_mutex_lock(philosopher->fork_own);
-	print_whats_happening(philosopher, "has taken a fork");
-	pthread_mutex_lock(philosopher->fork_borrowed);
-	print_whats_happening(philosopher, "has taken a fork");
-	pthread_mutex_lock(&philosopher->meal_update);
-	philosopher->time_last_ate = get_current_time();
-	pthread_mutex_unlock(&philosopher->meal_update);
-	print_whats_happening(philosopher, "is eating");
-	custom_usleep(philosopher->party->time_to_eat, philosopher->party);
-	pthread_mutex_unlock(philosopher->fork_own);
-	pthread_mutex_unlock(philosopher->fork_borrowed);
-	pthread_mutex_lock(&philosopher->meal_update);
-	philosopher->meal_count++;
-	pthread_mutex_unlock(&philosopher->meal_update);
-	print_whats_happening(philosopher, "is sleeping");
-	custom_usleep(philosopher->party->time_to_sleep, philosopher->party);
-	print_whats_happening(philosopher, "is thinking");
+	if (party->options.scheduled && wait_for_turn(philosopher) != SUCCESS)
+		return (SOMEONE_DIED);
+	if (eat(philosopher) != SUCCESS)
+		return (SOMEONE_DIED);
+	cpu_phase(&(philosopher->cpu), CPU_SLEEPING);
+	print_whats_happening(philosopher, PHILO_SLEEPING);
+	custom_usleep(party->time_to_sleep, philosopher);
+	cpu_phase(&(philosopher->cpu), CPU_THINKING);
+	print_whats_happening(philosopher, PHILO_THINKING);
+	if (party->options.adaptive_think && party->options.scheduled == 0)
+		think(philosopher);
 	return (SUCCESS);
 }
 
 /**
- * @brief Handles the philosopher's life routine.
+ * @brief Lives one party, from the first thought to the end of the party.
  *
- * This function is the main routine for a philosopher's life. It starts by 
- * unlocking the party's guard mutex to allow all philosophers to start their 
- * routines concurrently. The philosopher then prints that they are thinking 
- * and waits for a short time (if the philosopher's index is even) to allow 
- * others to start eating first and avoid potential deadlocks. The 
- * philosopher then enters an infinite loop where they keep performing the 
- * eat-sleep-think routine until a philosopher dies. If there is only one 
- * philosopher in the party, the philosopher picks up their fork and breaks 
- * out of the loop. After each iteration, the function checks if someone has 
- * died to break the loop. Once the loop ends, the function returns NULL.
+ * The philosopher prints that they are thinking and waits for a short time 
+ * (if the philosopher's seat on the whole table is even, which differs from 
+ * their index within a segment with `--segments`) to allow others to start 
+ * eating first and avoid potential deadlocks, unless the scheduled mode 
+ * already orders the meals. The philosopher then enters an infinite loop 
+ * where they keep performing the eat-sleep-think routine until a 
+ * philosopher dies. If there is only one philosopher in the party, the 
+ * philosopher picks up their fork and breaks out of the loop. After each 
+ * iteration, the function checks if someone has died to break the loop. 
+ * With `--cpu-stats`, the CPU time of the thread is accounted to the phase 
+ * it is in, see `cpu_phase`. A party restored from a snapshot skips the 
+ * first thought and the offset, and carries on with the activity of the 
+ * snapshot with `resume_activity`.
  *
- * @param philosopher_data A pointer to the t_philosopher struct representing 
- * the philosopher data.
+ * @param philosopher A pointer to the t_philosopher struct representing the 
+ * philosopher.
  */
-void	*philosopher_routine(void *philosopher_data)
+static void	attend_party(t_philosopher *philosopher)
 {
-	t_philosopher	*philosopher;
-	int				someone_dead;
+	int	someone_dead;
 
-	someone_dead = 0;
-	philosopher = (t_philosopher *)philosopher_data;
-	pthread_mutex_lock(&(philosopher->party->guard));
-	pthread_mutex_unlock(&(philosopher->party->guard));
-	print_whats_happening(philosopher, "is thinking");
-	if ((philosopher->index + 1) % 2 == 0)
-		custom_usleep(philosopher->party->time_to_eat / 10, philosopher->party);
+	cpu_start(&(philosopher->cpu), philosopher->party->options.cpu_stats,
+		CPU_THINKING);
+	if (resume_activity(philosopher) == 0)
+		print_whats_happening(philosopher, PHILO_THINKING);
+	if ((philosopher->party->segment.first_seat + philosopher->index + 1) % 2
+		== 0 && philosopher->party->options.scheduled == 0
+		&& philosopher->party->restored == NULL)
+		custom_usleep(philosopher->party->time_to_eat / 10, philosopher);
 	while (1)
 	{
 		if (eat_sleep_think(philosopher) == SINGLE_PHILO_CASE)
 		{
-			print_whats_happening(philosopher, "has taken a fork");
+			print_whats_happening(philosopher, PHILO_TOOK_FORK);
 			break ;
 		}
 		pthread_mutex_lock(&(philosopher->party->dying));
@@ -95,5 +135,72 @@ void	*philosopher_routine(void *philosopher_data)
 		if (someone_dead != 0)
 			break ;
 	}
+	cpu_stop(&(philosopher->cpu));
+}
+
+/**
+ * @brief Waits for all threads to be created.
+ *
+ * The creating thread holds the party's guard mutex until every thread is 
+ * created, so locking and unlocking it is enough to wait for them.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return int 1 if the start of the party was aborted meanwhile, 0 otherwise.
+ */
+static int	wait_for_guests(t_party *party)
+{
+	int	aborted;
+
+	pthread_mutex_lock(&(party->guard));
+	pthread_mutex_unlock(&(party->guard));
+	pthread_mutex_lock(&(party->dying));
+	aborted = party->someone_dead;
+	pthread_mutex_unlock(&(party->dying));
+	return (aborted != 0);
+}
+
+/**
+ * @brief Handles the philosopher's life routine.
+ *
+ * This function is the main routine for a philosopher's life. It starts by 
+ * creating the philosopher's children in the spawn tree with 
+ * `spawn_children` and picking up the forks held in the snapshot of 
+ * `--restore` with `claim_restored_forks`, then waits until all threads 
+ * are created with `wait_for_guests`, and leaves right away if the start 
+ * of the party was aborted. The philosopher then attends the party. With 
+ * `--repeat K`, the same thread attends K parties in a row, meeting the 
+ * other threads at the party's rendezvous barrier before each party, once 
+ * the seats are reset, and after it, once everyone has left the table.
+ *
+ * @param philosopher_data A pointer to the t_philosopher struct representing 
+ * the philosopher data.
+ * @return void* This function always returns NULL as it is intended to be 
+ * used as a pthread routine.
+ */
+void	*philosopher_routine(void *philosopher_data)
+{
+	t_philosopher	*philosopher;
+	t_party			*party;
+	unsigned int	run;
+
+	philosopher = (t_philosopher *)philosopher_data;
+	party = philosopher->party;
+	spawn_children(philosopher);
+	claim_restored_forks(philosopher);
+	if (wait_for_guests(party))
+		return (NULL);
+	if (party->options.repeat <= 1)
+	{
+		attend_party(philosopher);
+		return (NULL);
+	}
+	run = 0;
+	while (run < party->options.repeat)
+	{
+		barrier_wait(&(party->rendezvous));
+		attend_party(philosopher);
+		barrier_wait(&(party->rendezvous));
+		run++;
+	}
 	return (NULL);
 }
@@ -16,11 +16,21 @@
 /* ************************************************************************** */
 /*   Standard Library Headers 												  */
 /* ************************************************************************** */
+# include <limits.h>
+# include <poll.h>
 # include <pthread.h>
+# include <semaphore.h>
+# include <signal.h>
 # include <stdio.h>
 # include <stdlib.h>
+# include <string.h>
+# include <sys/mman.h>
+# include <sys/resource.h>
+# include <sys/socket.h>
 # include <sys/time.h>
+# include <sys/wait.h>
 # include <unistd.h>
+# include "libphilo.h"
 
 /* ************************************************************************** */
 /*   Define Constants														  */
@@ -29,79 +39,434 @@
 # define EXPECT_ARG_COUNT_WITH_MEALS 6
 # define MAX_AMOUNT_PHILO_ALLOWED 300
 # define MAX_TIME_VALUE 9223372036854775
+# define TURN_POLL_INTERVAL 100
+# define THINK_POLL_INTERVAL 200
+# define FORK_WAIT_TIMEOUT 1000
+# define FORK_MAX_WAITERS 2
+# define NO_DEATH 18446744073709551615ULL
+# define DEFAULT_STACK_SIZE 65536
+# define FORK_REQUEST 'R'
+# define FORK_GRANT 'G'
+# define FORK_RELEASE 'F'
+# define FORK_BATCH_SIZE 64
+# define SLEEP_SLICE 500
+# define MONITOR_INTERVAL 700
+# define LATENCY_BUCKET_WIDTH 5
+# define LATENCY_BUCKETS 1000
+# define REALTIME_PHILO_PRIORITY 10
+# define REALTIME_MONITOR_PRIORITY 20
+# define REALTIME_PREFAULT_SIZE 262144
+# define BURNER_SPIN 100000
+# define BACKPRESSURE_CHUNK 512
+# define CHECKPOINT_MAGIC "PHILOCK1"
+# define CHECKPOINT_DEFAULT_FILE "philo.checkpoint"
 
 /* ************************************************************************** */
 /*   Forward Declarations													  */
 /* ************************************************************************** */
 typedef struct s_party			t_party;
 typedef struct s_philosopher	t_philosopher;
+typedef struct s_options		t_options;
+typedef struct s_fork			t_fork;
+typedef struct s_barrier		t_barrier;
+typedef struct s_cpu_account	t_cpu_account;
+typedef struct s_disturbance	t_disturbance;
+typedef struct s_checkpoint_header	t_checkpoint_header;
+typedef struct s_checkpoint_seat	t_checkpoint_seat;
+typedef struct s_segment		t_segment;
+typedef struct s_segment_message	t_segment_message;
+typedef struct s_coordinator	t_coordinator;
+typedef struct s_shared_table	t_shared_table;
 typedef enum e_return_value		t_return_value;
 
+/* ************************************************************************** */
+/*   Enum Definitions														  */
+/* ************************************************************************** */
+typedef enum e_return_value
+{
+	SUCCESS,
+	ERROR,
+	ARG_COUNT_ERROR,
+	ARG_NOT_NUMERIC,
+	UNKNOWN_OPTION,
+	TOO_MANY_PHILOS,
+	MALLOC_FAIL,
+	MUTEX_FAIL,
+	THREAD_FAIL,
+	JOIN_FAIL,
+	SINGLE_PHILO_CASE,
+	LIFE_GOES_ON,
+	SOMEONE_DIED,
+	EVERYONE_IS_FED,
+	DEADLOCKED,
+	LIVELOCKED,
+	CONFLICTING_OPTIONS,
+}						t_return_value;
+
+typedef enum e_cpu_phase
+{
+	CPU_FORK_WAIT,
+	CPU_EATING,
+	CPU_SLEEPING,
+	CPU_LOGGING,
+	CPU_THINKING,
+	CPU_MONITORING,
+	CPU_PHASES,
+}						t_cpu_phase;
+
+typedef enum e_segment_message_type
+{
+	SEGMENT_READY,
+	SEGMENT_GO,
+	SEGMENT_DIED,
+	SEGMENT_FED,
+	SEGMENT_STOP,
+	SEGMENT_ACK,
+	SEGMENT_PRINT,
+	SEGMENT_MEALS,
+}						t_segment_message_type;
+
 /* ************************************************************************** */
 /*   Struct Definitions														  */
 /* ************************************************************************** */
+typedef struct s_fork
+{
+	pthread_mutex_t		lock;
+	pthread_mutex_t		arbiter;
+	pthread_cond_t		handed_over;
+	t_philosopher		*holder;
+	t_philosopher		*waiters[FORK_MAX_WAITERS];
+	unsigned long long	deadlines[FORK_MAX_WAITERS];
+	unsigned int		waiter_count;
+	int					remote;
+}						t_fork;
+
+/*
+ * CPU time of one thread, in ns, split by the phase it was in, and its
+ * context switches. Only filled in with `--cpu-stats`.
+ */
+typedef struct s_cpu_account
+{
+	int					enabled;
+	t_cpu_phase			phase;
+	unsigned long long	mark;
+	unsigned long long	time[CPU_PHASES];
+	long				voluntary_switches;
+	long				involuntary_switches;
+}						t_cpu_account;
+
+typedef struct s_barrier
+{
+	pthread_mutex_t		lock;
+	pthread_cond_t		all_arrived;
+	unsigned int		parties;
+	unsigned int		arrived;
+	unsigned long long	generation;
+}						t_barrier;
+
+typedef struct s_disturbance
+{
+	pthread_t			*burners;
+	unsigned int		burners_started;
+	int					stopping;
+	pthread_mutex_t		stop;
+	int					saved_stdout;
+	int					pipe_out;
+	pthread_t			reader;
+	int					active;
+}						t_disturbance;
+
+typedef struct s_prepared
+{
+	unsigned int		seats;
+	unsigned int		forks;
+	int					locks;
+	int					spawning;
+}						t_prepared;
+
+typedef struct s_checkpoint_header
+{
+	char				magic[8];
+	unsigned int		number_of_philosophers;
+	int					number_of_meals;
+	unsigned long long	time_to_die;
+	unsigned long long	time_to_eat;
+	unsigned long long	time_to_sleep;
+	unsigned long long	time;
+}						t_checkpoint_header;
+
+typedef struct s_checkpoint_seat
+{
+	unsigned long long	since_ate;
+	unsigned long long	elapsed;
+	unsigned int		meal_count;
+	unsigned int		activity;
+	unsigned int		forks_held;
+	unsigned int		padding;
+}						t_checkpoint_seat;
+
 typedef struct s_philosopher
 {
 	pthread_t			thread;
-	pthread_mutex_t		*fork_own;
-	pthread_mutex_t		*fork_borrowed;
+	t_fork				*fork_own;
+	t_fork				*fork_borrowed;
 	int					meal_count;
 	unsigned int		index;
 	unsigned long long	time_last_ate;
+	long long			min_slack;
+	unsigned long long	next_round;
+	int					thread_started;
+	t_fork				*waiting_for;
+	unsigned long long	waiting_since;
+	int					waits_on;
+	unsigned int		waited_fork;
+	unsigned long long	wait_snapshot;
+	unsigned long long	stuck_since;
+	t_cpu_account		cpu;
+	unsigned int		*latency;
+	unsigned int		jitter_seed;
+	t_philo_event_type	activity;
+	unsigned long long	activity_since;
+	unsigned long long	last_meal_logged;
+	unsigned int		forks_held;
+	int					activity_meals;
 	pthread_mutex_t		meal_update;
 	t_party				*party;
 }						t_philosopher;
 
+typedef struct s_options
+{
+	int					scheduled;
+	int					stats;
+	int					adaptive_think;
+	int					edf;
+	unsigned int		repeat;
+	unsigned int		stack_size;
+	int					serial_spawn;
+	unsigned int		segments;
+	int					processes;
+	unsigned int		livelock;
+	int					deadlock;
+	int					cpu_stats;
+	int					realtime;
+	unsigned int		monitor_core;
+	int					latency;
+	unsigned int		jitter;
+	unsigned int		burners;
+	unsigned int		backpressure;
+	unsigned int		checkpoint_at;
+	const char			*checkpoint_file;
+	const char			*restore_file;
+}						t_options;
+
+typedef struct s_segment
+{
+	unsigned int		index;
+	unsigned int		count;
+	unsigned int		first_seat;
+	unsigned long long	start_time;
+	int					control;
+	int					fork_server;
+	pthread_t			server_thread;
+	int					server_started;
+	int					fed_reported;
+}						t_segment;
+
+typedef struct s_segment_message
+{
+	t_segment_message_type	type;
+	unsigned int			seat;
+	unsigned long long		value;
+}						t_segment_message;
+
+typedef struct s_coordinator
+{
+	struct pollfd		*segments;
+	unsigned char		*quiet;
+	unsigned int		count;
+	unsigned int		open;
+	unsigned int		ready;
+	unsigned int		fed;
+	int					winner;
+	int					stopping;
+	int					death_granted;
+	t_return_value		outcome;
+	unsigned long long	start_time;
+	unsigned long long	end_time;
+	unsigned long long	meals;
+}						t_coordinator;
+
+typedef struct s_shared_table
+{
+	sem_t				start_gate;
+	sem_t				print;
+	sem_t				forks[MAX_AMOUNT_PHILO_ALLOWED];
+	sem_t				meal_update[MAX_AMOUNT_PHILO_ALLOWED];
+	unsigned long long	time_last_ate[MAX_AMOUNT_PHILO_ALLOWED];
+	int					meal_count[MAX_AMOUNT_PHILO_ALLOWED];
+	unsigned long long	start_time;
+	int					ended;
+}						t_shared_table;
+
 typedef struct s_party
 {
 	unsigned int		number_of_philosophers;
+	unsigned int		number_of_forks;
 	unsigned long long	time_to_die;
 	unsigned long long	time_to_eat;
 	unsigned long long	time_to_sleep;
 	unsigned long long	party_start_time;
+	unsigned long long	party_end_time;
 	int					number_of_meals;
+	t_options			options;
 	t_philosopher		*philosophers;
 	pthread_t			monitoring_thread;
-	pthread_mutex_t		*forks;
+	t_fork				*forks;
 	pthread_mutex_t		guard;
 	pthread_mutex_t		dying;
 	unsigned int		someone_dead;
+	unsigned int		deadlock_suspect;
+	unsigned char		*schedule;
+	unsigned int		schedule_rounds;
+	unsigned long long	round_serial;
+	unsigned int		round_eaters_left;
+	unsigned long long	round_start_time;
+	pthread_mutex_t		scheduling;
+	pthread_attr_t		thread_attributes;
+	pthread_mutex_t		spawning;
+	pthread_cond_t		spawn_reported;
+	unsigned int		threads_started;
+	unsigned int		threads_reported;
+	unsigned long long	spawn_duration;
+	long				startup_rss;
+	long				startup_vsz;
+	long				startup_private;
+	long				startup_pss;
+	int					started;
+	int					joined;
+	t_prepared			prepared;
+	t_return_value		outcome;
+	unsigned int		dead_philosopher;
+	unsigned long long	death_time;
+	unsigned long long	death_deadline;
+	t_barrier			rendezvous;
+	t_cpu_account		monitor_cpu;
+	int					realtime_active;
+	unsigned int		*latency;
+	unsigned int		*monitor_latency;
+	t_disturbance		disturbance;
+	t_checkpoint_seat	*checkpoint;
+	t_checkpoint_seat	*restored;
+	unsigned long long	restored_time;
+	int					checkpoint_taken;
+	t_segment			segment;
+	t_shared_table		*shared;
+	pid_t				*pids;
+	t_philo_event_callback	event_callback;
+	void				*event_data;
 }						t_party;
 
-/* ************************************************************************** */
-/*   Enum Definitions														  */
-/* ************************************************************************** */
-typedef enum e_return_value
-{
-	SUCCESS,
-	ERROR,
-	ARG_COUNT_ERROR,
-	ARG_NOT_NUMERIC,
-	TOO_MANY_PHILOS,
-	MALLOC_FAIL,
-	MUTEX_FAIL,
-	THREAD_FAIL,
-	JOIN_FAIL,
-	SINGLE_PHILO_CASE,
-	LIFE_GOES_ON,
-	SOMEONE_DIED,
-	EVERYONE_IS_FED,
-}						t_return_value;
 /* ************************************************************************** */
 /*   Function Prototypes													  */
 /* ************************************************************************** */
 t_return_value			parse_args(t_party *party, int argc, char **argv);
+t_return_value			parse_options(t_party *party, int *argc, char **argv);
+unsigned long long		ascii_to_positive_int(const char *str);
 unsigned long long		get_current_time(void);
 void					custom_usleep(unsigned long long duration,
-							t_party *party);
+							t_philosopher *philosopher);
 void					print_whats_happening(t_philosopher *philosopher,
-							char *event);
+							t_philo_event_type event);
+void					emit_event(t_party *party, unsigned int index,
+							t_philo_event_type event);
 t_return_value			prepare_party(t_party *party);
+t_return_value			start_dining_party(t_party *party);
+t_return_value			run_dining_party(t_party *party);
+t_return_value			prepare_thread_spawning(t_party *party);
+t_return_value			init_default_policy(pthread_attr_t *attributes);
 t_return_value			start_philosopher(t_party *party, unsigned int i);
+t_return_value			spawn_philosophers(t_party *party);
+void					spawn_children(t_philosopher *philosopher);
+void					measure_startup_footprint(t_party *party);
+long					proportional_set_size(pid_t pid);
+void					report_startup(t_party *party);
 t_return_value			start_monitoring(t_party *party);
 void					*philosopher_routine(void *philosopher_data);
 void					*monitoring_routine(void *party_data);
 void					clean_up(t_party *party);
+t_return_value			initialize_table_locks(t_party *party);
+void					destroy_party_locks(t_party *party);
 t_return_value			join_threads_to_exit_party(t_party *party);
+t_return_value			prepare_schedule(t_party *party);
+t_return_value			wait_for_turn(t_philosopher *philosopher);
+void					think(t_philosopher *philosopher);
+t_return_value			take_fork(t_philosopher *philosopher, t_fork *fork);
+void					release_fork(t_philosopher *philosopher, t_fork *fork);
+void					note_fork_wait(t_philosopher *philosopher,
+							t_fork *fork);
+t_return_value			lock_fork(t_philosopher *philosopher, t_fork *fork);
+void					unlock_fork(t_philosopher *philosopher, t_fork *fork);
+void					start_fork_wait(t_philosopher *philosopher,
+							t_fork *fork);
+t_return_value			detect_deadlock(t_party *party);
+t_return_value			detect_livelock(t_party *party);
+void					cpu_start(t_cpu_account *account, int enabled,
+							t_cpu_phase phase);
+t_cpu_phase				cpu_phase(t_cpu_account *account, t_cpu_phase phase);
+void					cpu_stop(t_cpu_account *account);
+void					report_cpu_statistics(t_party *party);
+void					enter_realtime(t_party *party);
+void					raise_monitor(t_party *party);
+t_return_value			prepare_latency(t_party *party);
+void					measured_usleep(unsigned int *histogram,
+							unsigned long long duration);
+void					report_latency(t_party *party);
+unsigned long long		jitter_delay(t_philosopher *philosopher);
+t_return_value			start_disturbances(t_party *party);
+void					stop_disturbances(t_party *party);
+t_return_value			start_backpressure(t_party *party);
+void					stop_backpressure(t_party *party);
+t_return_value			prepare_checkpoint(t_party *party);
+void					note_activity(t_philosopher *philosopher,
+							t_philo_event_type event);
+void					check_checkpoint(t_party *party);
+t_return_value			load_checkpoint(t_party *party);
+void					apply_restore(t_party *party);
+void					claim_restored_forks(t_philosopher *philosopher);
+int						resume_activity(t_philosopher *philosopher);
+void					record_meal_start(t_philosopher *philosopher);
+t_return_value			barrier_init(t_barrier *barrier, unsigned int parties);
+void					barrier_wait(t_barrier *barrier);
+void					barrier_destroy(t_barrier *barrier);
+t_return_value			run_repeated_party(t_party *party);
+void					report_repetitions(t_party *party,
+							unsigned long long *results);
+unsigned long long		table_meal_count(t_party *party);
+void					collect_statistics(t_party *party,
+							t_philo_statistics *statistics);
+void					report_statistics(t_party *party);
+t_return_value			check_option_combinations(t_party *party);
+t_return_value			run_segmented_table(t_party *party);
+t_return_value			open_segment_links(int *links, unsigned int count);
+void					keep_segment_links(int *links, unsigned int count,
+							unsigned int keeper);
+void					coordinate_segments(t_coordinator *coordinator);
+int						send_segment_message(int socket,
+							t_segment_message_type type, unsigned int seat,
+							unsigned long long value);
+t_return_value			join_segments(t_party *party);
+void					leave_segments(t_party *party, t_return_value ret_val);
+int						segment_claims_death(t_party *party, unsigned int i);
+int						segment_was_stopped(t_party *party);
+t_return_value			report_segment_fed(t_party *party);
+void					*serve_boundary_fork(void *party_data);
+t_return_value			take_remote_fork(t_philosopher *philosopher,
+							t_fork *fork);
+void					release_remote_fork(t_fork *fork);
+t_return_value			run_process_table(t_party *party);
+void					philosopher_process(t_party *party, unsigned int i);
+void					monitor_processes(t_party *party);
+void					measure_process_footprint(t_party *party);
+void					report_process_table(t_party *party);
 
 #endif
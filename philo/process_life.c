@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   process_life.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:52:10 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 16:52:10 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Prints an event of a philosopher process.
+ *
+ * The print semaphore serializes the log of all processes, and nothing is
+ * printed once the monitor has ended the table.
+ *
+ * @param party A pointer to the t_party struct of the process.
+ * @param i The index of the philosopher.
+ * @param event The type of the event.
+ */
+static void	process_print(t_party *party, unsigned int i,
+		t_philo_event_type event)
+{
+	sem_wait(&(party->shared->print));
+	if (party->shared->ended == 0)
+		emit_event(party, i, event);
+	sem_post(&(party->shared->print));
+}
+
+/**
+ * @brief Sleeps for a given duration in small steps.
+ *
+ * Unlike `custom_usleep`, it does not watch the end of the party: a
+ * philosopher process is killed by the monitor when the table ends.
+ *
+ * @param duration The duration in microseconds.
+ */
+static void	process_sleep(unsigned long long duration)
+{
+	unsigned long long	start_time;
+
+	start_time = get_current_time();
+	while (get_current_time() - start_time < duration)
+		usleep(500);
+}
+
+/**
+ * @brief Picks up both fork semaphores and eats for time_to_eat.
+ *
+ * The start of the meal and the meal count are published in the shared
+ * table under the philosopher's meal_update semaphore, for the monitor.
+ *
+ * @param party A pointer to the t_party struct of the process.
+ * @param i The index of the philosopher.
+ */
+static void	process_eat(t_party *party, unsigned int i)
+{
+	t_shared_table	*shared;
+	unsigned int	next;
+
+	shared = party->shared;
+	next = (i + 1) % party->number_of_philosophers;
+	sem_wait(&(shared->forks[i]));
+	process_print(party, i, PHILO_TOOK_FORK);
+	sem_wait(&(shared->forks[next]));
+	process_print(party, i, PHILO_TOOK_FORK);
+	sem_wait(&(shared->meal_update[i]));
+	shared->time_last_ate[i] = get_current_time();
+	sem_post(&(shared->meal_update[i]));
+	process_print(party, i, PHILO_EATING);
+	process_sleep(party->time_to_eat);
+	sem_post(&(shared->forks[i]));
+	sem_post(&(shared->forks[next]));
+	sem_wait(&(shared->meal_update[i]));
+	shared->meal_count[i]++;
+	sem_post(&(shared->meal_update[i]));
+}
+
+/**
+ * @brief Lives the life of a philosopher in its own process.
+ *
+ * The philosopher waits at the start gate until the monitor has started
+ * the table, then eats, sleeps and thinks like a philosopher thread, even
+ * seats letting their neighbours eat first. A lone philosopher takes their
+ * only fork and waits. The process never returns: the monitor kills it
+ * when the table ends.
+ *
+ * @param party A pointer to the t_party struct of the process.
+ * @param i The index of the philosopher.
+ */
+void	philosopher_process(t_party *party, unsigned int i)
+{
+	sem_wait(&(party->shared->start_gate));
+	party->party_start_time = party->shared->start_time;
+	process_print(party, i, PHILO_THINKING);
+	if (party->number_of_philosophers == 1)
+	{
+		sem_wait(&(party->shared->forks[i]));
+		process_print(party, i, PHILO_TOOK_FORK);
+		while (1)
+			pause();
+	}
+	if ((i + 1) % 2 == 0)
+		process_sleep(party->time_to_eat / 10);
+	while (1)
+	{
+		process_eat(party, i);
+		process_print(party, i, PHILO_SLEEPING);
+		process_sleep(party->time_to_sleep);
+		process_print(party, i, PHILO_THINKING);
+	}
+}
@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   process_monitor.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:08:44 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 17:08:44 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Ends the table of philosopher processes.
+ *
+ * Taking the print semaphore makes sure no philosopher is halfway through
+ * a line; once ended is set they print nothing anymore.
+ *
+ * @param shared A pointer to the t_shared_table of the table.
+ */
+static void	end_table(t_shared_table *shared)
+{
+	sem_wait(&(shared->print));
+	shared->ended = 1;
+	sem_post(&(shared->print));
+}
+
+/**
+ * @brief Checks if any philosopher process has starved.
+ *
+ * Same check as the thread monitor, on the meal times published in the
+ * shared table. The death is printed while the print semaphore is held and
+ * the table ended, so it is the last line of the log.
+ *
+ * @param party A pointer to the t_party struct of the monitor.
+ * @return t_return_value SOMEONE_DIED or LIFE_GOES_ON
+ */
+static t_return_value	process_starved(t_party *party)
+{
+	t_shared_table		*shared;
+	unsigned int		i;
+	unsigned long long	time_last_ate;
+
+	shared = party->shared;
+	i = 0;
+	while (i < party->number_of_philosophers)
+	{
+		sem_wait(&(shared->meal_update[i]));
+		time_last_ate = shared->time_last_ate[i];
+		sem_post(&(shared->meal_update[i]));
+		if (get_current_time() - time_last_ate >= party->time_to_die)
+		{
+			sem_wait(&(shared->print));
+			shared->ended = 1;
+			party->dead_philosopher = i;
+			party->death_time = get_current_time();
+			party->death_deadline = time_last_ate + party->time_to_die;
+			emit_event(party, i, PHILO_DIED);
+			sem_post(&(shared->print));
+			return (SOMEONE_DIED);
+		}
+		i++;
+	}
+	return (LIFE_GOES_ON);
+}
+
+/**
+ * @brief Checks if every philosopher process has eaten enough meals.
+ *
+ * @param party A pointer to the t_party struct of the monitor.
+ * @return t_return_value EVERYONE_IS_FED or LIFE_GOES_ON
+ */
+static t_return_value	processes_fed(t_party *party)
+{
+	unsigned int	i;
+	int				meal_count;
+
+	if (party->number_of_meals < 0)
+		return (LIFE_GOES_ON);
+	i = 0;
+	while (i < party->number_of_philosophers)
+	{
+		sem_wait(&(party->shared->meal_update[i]));
+		meal_count = party->shared->meal_count[i];
+		sem_post(&(party->shared->meal_update[i]));
+		if (meal_count < party->number_of_meals)
+			return (LIFE_GOES_ON);
+		i++;
+	}
+	end_table(party->shared);
+	return (EVERYONE_IS_FED);
+}
+
+/**
+ * @brief Watches the table of philosopher processes until it ends.
+ *
+ * The monitor is the parent process, central to the table like the
+ * monitoring thread is to a party, and polls every 700 us.
+ *
+ * @param party A pointer to the t_party struct of the monitor.
+ */
+void	monitor_processes(t_party *party)
+{
+	while (1)
+	{
+		party->outcome = process_starved(party);
+		if (party->outcome == LIFE_GOES_ON)
+			party->outcome = processes_fed(party);
+		if (party->outcome != LIFE_GOES_ON)
+			break ;
+		usleep(700);
+	}
+	party->party_end_time = get_current_time();
+}
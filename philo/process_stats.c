@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   process_stats.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:21:05 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 17:21:05 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+#include <fcntl.h>
+
+/**
+ * @brief Reads a field of /proc/<pid>/statm.
+ *
+ * The fields are counts of pages: 0 is the program size, 1 the resident 
+ * set and 2 its shared part. Systems without procfs report 0.
+ *
+ * @param pid The process to look at.
+ * @param field The index of the field.
+ * @return long The value of the field in KiB, or 0 if unknown.
+ */
+static long	statm_field(pid_t pid, int field)
+{
+	char	buffer[128];
+	ssize_t	length;
+	long	pages;
+	int		fd;
+	int		i;
+
+	snprintf(buffer, sizeof(buffer), "/proc/%d/statm", (int)pid);
+	fd = open(buffer, O_RDONLY);
+	if (fd < 0)
+		return (0);
+	length = read(fd, buffer, sizeof(buffer) - 1);
+	close(fd);
+	i = 0;
+	while (field > 0 && i < length)
+	{
+		if (buffer[i++] == ' ')
+			field--;
+	}
+	pages = 0;
+	while (i < length && buffer[i] >= '0' && buffer[i] <= '9')
+		pages = pages * 10 + buffer[i++] - '0';
+	return (pages * (sysconf(_SC_PAGESIZE) / 1024));
+}
+
+/**
+ * @brief Samples the memory footprint of the table of processes.
+ *
+ * The resident sets of the monitor and of every philosopher process are 
+ * added up in startup_rss, which counts the pages they share once per 
+ * process, and their private parts in startup_private. Their proportional 
+ * set sizes add up in startup_pss, which counts the shared pages once in 
+ * all, as the single process of the thread backend does.
+ *
+ * @param party A pointer to the t_party struct of the monitor.
+ */
+void	measure_process_footprint(t_party *party)
+{
+	unsigned int	i;
+	long			rss;
+
+	party->startup_rss = statm_field(getpid(), 1);
+	party->startup_private = party->startup_rss - statm_field(getpid(), 2);
+	party->startup_pss = proportional_set_size(getpid());
+	i = 0;
+	while (i < party->number_of_philosophers)
+	{
+		rss = statm_field(party->pids[i], 1);
+		party->startup_rss += rss;
+		party->startup_private += rss - statm_field(party->pids[i], 2);
+		party->startup_pss += proportional_set_size(party->pids[i]);
+		i++;
+	}
+}
+
+/**
+ * @brief Prints the startup cost and the throughput of the process table.
+ *
+ * With `--stats`, prints the same lines as the thread backend: the startup 
+ * line, with the time to fork every philosopher and the footprint from 
+ * `measure_process_footprint`, and the stats line with the meals and their 
+ * rate against the floor(N / 2) bound, plus the death detection lag.
+ *
+ * @param party A pointer to the t_party struct of the monitor.
+ */
+void	report_process_table(t_party *party)
+{
+	unsigned long long	meals;
+	double				duration;
+	unsigned int		i;
+
+	if (party->options.stats == 0)
+		return ;
+	meals = 0;
+	i = 0;
+	while (i < party->number_of_philosophers)
+		meals += party->shared->meal_count[i++];
+	duration = (party->party_end_time - party->party_start_time) / 1e6;
+	if (duration <= 0)
+		duration = 1e-6;
+	fprintf(stderr, "startup\tprocesses %u\tfork %.3f ms\trss %ld KiB\t"
+		"private %ld KiB\tpss %ld KiB\n", party->number_of_philosophers,
+		party->spawn_duration / 1000.0, party->startup_rss,
+		party->startup_private, party->startup_pss);
+	fprintf(stderr, "stats\tmeals %llu\tduration %.3f s\tmeals/s %.2f\t"
+		"bound %.2f", meals, duration, meals / duration,
+		(party->number_of_philosophers / 2) * 1e6 / party->time_to_eat);
+	if (party->outcome == SOMEONE_DIED)
+		fprintf(stderr, "\tdeath lag %.3f ms",
+			(party->death_time - party->death_deadline) / 1000.0);
+	fprintf(stderr, "\n");
+}
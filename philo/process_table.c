@@ -0,0 +1,172 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   process_table.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:38:27 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 16:38:27 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Maps the table shared by the philosopher processes.
+ *
+ * The table is an anonymous shared mapping inherited through fork(). It
+ * holds one process-shared semaphore per fork and per philosopher's meal
+ * data, the print semaphore serializing the log and the start gate.
+ *
+ * @param party A pointer to the t_party struct holding the arguments.
+ * @return t_return_value SUCCESS, MALLOC_FAIL or MUTEX_FAIL
+ */
+static t_return_value	open_shared_table(t_party *party)
+{
+	t_shared_table	*shared;
+	unsigned int	i;
+
+	shared = mmap(NULL, sizeof(t_shared_table), PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (shared == MAP_FAILED)
+		return (MALLOC_FAIL);
+	party->shared = shared;
+	shared->ended = 0;
+	if (sem_init(&(shared->start_gate), 1, 0) != 0
+		|| sem_init(&(shared->print), 1, 1) != 0)
+		return (MUTEX_FAIL);
+	i = 0;
+	while (i < party->number_of_philosophers)
+	{
+		shared->meal_count[i] = 0;
+		if (sem_init(&(shared->forks[i]), 1, 1) != 0
+			|| sem_init(&(shared->meal_update[i]), 1, 1) != 0)
+			return (MUTEX_FAIL);
+		i++;
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @brief Forks one process per philosopher.
+ *
+ * Each child lives in `philosopher_process` and never returns.
+ *
+ * @param party A pointer to the t_party struct holding the arguments.
+ * @return unsigned int The number of processes started.
+ */
+static unsigned int	spawn_processes(t_party *party)
+{
+	unsigned int	i;
+	pid_t			pid;
+
+	i = 0;
+	while (i < party->number_of_philosophers)
+	{
+		pid = fork();
+		if (pid == 0)
+			philosopher_process(party, i);
+		if (pid < 0)
+		{
+			printf("Failed to create a philo process\n");
+			return (i);
+		}
+		party->pids[i] = pid;
+		i++;
+	}
+	return (i);
+}
+
+/**
+ * @brief Starts the table once every philosopher process exists.
+ *
+ * @param party A pointer to the t_party struct of the monitor.
+ */
+static void	open_start_gate(t_party *party)
+{
+	unsigned int	i;
+
+	party->party_start_time = get_current_time();
+	party->shared->start_time = party->party_start_time;
+	i = 0;
+	while (i < party->number_of_philosophers)
+		party->shared->time_last_ate[i++] = party->party_start_time;
+	i = 0;
+	while (i < party->number_of_philosophers)
+	{
+		sem_post(&(party->shared->start_gate));
+		i++;
+	}
+}
+
+/**
+ * @brief Kills and reaps the philosopher processes, then unmaps the table.
+ *
+ * @param party A pointer to the t_party struct of the monitor.
+ * @param started The number of processes started.
+ */
+static void	close_table(t_party *party, unsigned int started)
+{
+	unsigned int	i;
+
+	i = 0;
+	while (i < started)
+		kill(party->pids[i++], SIGKILL);
+	i = 0;
+	while (i < started)
+		waitpid(party->pids[i++], NULL, 0);
+	i = 0;
+	while (i < party->number_of_philosophers)
+	{
+		sem_destroy(&(party->shared->forks[i]));
+		sem_destroy(&(party->shared->meal_update[i]));
+		i++;
+	}
+	sem_destroy(&(party->shared->start_gate));
+	sem_destroy(&(party->shared->print));
+	munmap(party->shared, sizeof(t_shared_table));
+}
+
+/**
+ * @brief Runs the table with one process per philosopher.
+ *
+ * The `--processes` backend forks every philosopher as a process sharing
+ * the table through semaphores in shared memory, while this process
+ * monitors the table with `monitor_processes`. The log format is the same
+ * as with threads. stdout is line buffered so that lines of different
+ * processes do not mix.
+ *
+ * @param party A pointer to the t_party struct holding the parsed arguments.
+ * @return t_return_value SUCCESS, MALLOC_FAIL, MUTEX_FAIL or THREAD_FAIL
+ */
+t_return_value	run_process_table(t_party *party)
+{
+	t_return_value		ret_val;
+	unsigned int		started;
+
+	party->segment.first_seat = 0;
+	party->event_callback = NULL;
+	party->pids = malloc(sizeof(pid_t) * party->number_of_philosophers);
+	if (party->pids == NULL)
+		return (MALLOC_FAIL);
+	ret_val = open_shared_table(party);
+	if (ret_val != SUCCESS)
+		return (ret_val);
+	setvbuf(stdout, NULL, _IOLBF, 0);
+	party->spawn_duration = get_current_time();
+	started = spawn_processes(party);
+	party->spawn_duration = get_current_time() - party->spawn_duration;
+	if (started == party->number_of_philosophers)
+	{
+		measure_process_footprint(party);
+		open_start_gate(party);
+		monitor_processes(party);
+		report_process_table(party);
+	}
+	close_table(party, started);
+	free(party->pids);
+	if (started != party->number_of_philosophers)
+		return (THREAD_FAIL);
+	return (SUCCESS);
+}
@@ -0,0 +1,158 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   realtime.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 21:27:05 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 21:27:05 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "philosophers.h"
+#include <errno.h>
+#include <sched.h>
+
+/**
+ * @brief Keeps the process's memory resident and touches the stack ahead.
+ *
+ * mlockall keeps every current and future page in RAM, so that no thread
+ * stalls on a page fault during the party. The next REALTIME_PREFAULT_SIZE
+ * bytes of the calling thread's stack are written once so that they are
+ * faulted in now rather than mid-party.
+ */
+static void	lock_memory(void)
+{
+	volatile char	stack[REALTIME_PREFAULT_SIZE];
+	unsigned int	offset;
+
+	if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+		fprintf(stderr, "realtime\twarning: mlockall refused (%s)\n",
+			strerror(errno));
+	offset = 0;
+	while (offset < REALTIME_PREFAULT_SIZE)
+	{
+		stack[offset] = 0;
+		offset += 4096;
+	}
+	offset = stack[0];
+}
+
+/**
+ * @brief Moves the calling thread to the SCHED_FIFO policy.
+ *
+ * Called on the main thread before any thread is created: the philosopher
+ * threads inherit its policy and priority. Without CAP_SYS_NICE or an
+ * RLIMIT_RTPRIO allowance the kernel refuses with EPERM; the party then runs
+ * under the default policy after a warning.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ */
+static void	enter_fifo(t_party *party)
+{
+	struct sched_param	param;
+	int					error;
+
+	memset(&param, 0, sizeof(param));
+	param.sched_priority = REALTIME_PHILO_PRIORITY;
+	error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+	if (error != 0)
+	{
+		fprintf(stderr, "realtime\twarning: SCHED_FIFO refused (%s), "
+			"running with the default policy\n", strerror(error));
+		return ;
+	}
+	party->realtime_active = 1;
+}
+
+/**
+ * @brief Keeps the philosophers off the core reserved to the monitor.
+ *
+ * The core is removed from the main thread's affinity before any thread is
+ * created, so the philosophers inherit an affinity without it. An unknown
+ * core, or a machine with a single allowed CPU, is reported and the option
+ * is dropped.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ */
+static void	isolate_monitor_core(t_party *party)
+{
+	cpu_set_t		cpus;
+	unsigned int	core;
+
+	core = party->options.monitor_core - 1;
+	if (sched_getaffinity(0, sizeof(cpus), &cpus) != 0
+		|| core >= CPU_SETSIZE || CPU_ISSET(core, &cpus) == 0
+		|| CPU_COUNT(&cpus) < 2)
+	{
+		fprintf(stderr, "realtime\twarning: CPU %u cannot be reserved to "
+			"the monitor, ignoring --monitor-core\n", core);
+		party->options.monitor_core = 0;
+		return ;
+	}
+	CPU_CLR(core, &cpus);
+	if (sched_setaffinity(0, sizeof(cpus), &cpus) != 0)
+	{
+		fprintf(stderr, "realtime\twarning: affinity refused (%s), "
+			"ignoring --monitor-core\n", strerror(errno));
+		party->options.monitor_core = 0;
+	}
+}
+
+/**
+ * @brief Prepares the low-jitter mode before the threads are created.
+ *
+ * With `--realtime`, the memory is locked and prefaulted and the main thread
+ * moves to SCHED_FIFO, which every thread created afterwards inherits. With
+ * `--monitor-core C`, CPU C is kept for the monitor alone. Each refusal of
+ * the kernel is a warning, never an error: the party still runs.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ */
+void	enter_realtime(t_party *party)
+{
+	if (party->options.realtime)
+	{
+		lock_memory();
+		enter_fifo(party);
+	}
+	if (party->options.monitor_core)
+		isolate_monitor_core(party);
+}
+
+/**
+ * @brief Gives the monitor its priority and core.
+ *
+ * Called by the monitor thread itself. In realtime mode it runs above the
+ * philosophers, so that a philosopher busy on its CPU never delays the
+ * detection of a death; with `--monitor-core C` it is pinned to CPU C.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ */
+void	raise_monitor(t_party *party)
+{
+	struct sched_param	param;
+	cpu_set_t			cpus;
+	int					error;
+
+	if (party->realtime_active)
+	{
+		memset(&param, 0, sizeof(param));
+		param.sched_priority = REALTIME_MONITOR_PRIORITY;
+		error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+		if (error != 0)
+			fprintf(stderr, "realtime\twarning: monitor priority refused "
+				"(%s)\n", strerror(error));
+	}
+	if (party->options.monitor_core)
+	{
+		CPU_ZERO(&cpus);
+		CPU_SET(party->options.monitor_core - 1, &cpus);
+		error = pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+		if (error != 0)
+			fprintf(stderr, "realtime\twarning: monitor pinning refused "
+				"(%s)\n", strerror(error));
+	}
+}
@@ -0,0 +1,163 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   remote_fork.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:02:48 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 15:02:48 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Checks if the party has ended.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return int 1 if party->someone_dead is set, 0 otherwise.
+ */
+static int	party_is_over(t_party *party)
+{
+	int	someone_dead;
+
+	pthread_mutex_lock(&(party->dying));
+	someone_dead = party->someone_dead;
+	pthread_mutex_unlock(&(party->dying));
+	return (someone_dead != 0);
+}
+
+/**
+ * @brief Handles a batch of fork messages from the previous segment.
+ *
+ * Messages are handled in order: a request takes the boundary fork with
+ * `take_fork` on behalf of the remote philosopher and answers with a grant,
+ * a release puts it back with `release_fork`. A release and the next
+ * request of the same philosopher often arrive in the same batch.
+ *
+ * @param proxy The t_philosopher standing for the remote philosopher.
+ * @param batch The messages read from the socket.
+ * @param size The number of messages in the batch.
+ * @param held Whether the server holds the fork, updated along the batch.
+ */
+static void	handle_batch(t_philosopher *proxy, const char *batch,
+		ssize_t size, int *held)
+{
+	t_party	*party;
+	ssize_t	i;
+	char	grant;
+
+	party = proxy->party;
+	grant = FORK_GRANT;
+	i = 0;
+	while (i < size)
+	{
+		if (batch[i] == FORK_REQUEST && *held == 0
+			&& take_fork(proxy, &(party->forks[0])) == SUCCESS)
+		{
+			*held = 1;
+			send(party->segment.fork_server, &grant, 1, MSG_NOSIGNAL);
+		}
+		else if (batch[i] == FORK_RELEASE && *held)
+		{
+			release_fork(proxy, &(party->forks[0]));
+			*held = 0;
+		}
+		i++;
+	}
+}
+
+/**
+ * @brief Serves the segment's first fork to the previous segment.
+ *
+ * The first fork of a segment is also the borrowed fork of the last seat of
+ * the previous segment, which lives in another process. This routine runs
+ * in its own thread and takes and puts back the fork for that philosopher
+ * as their messages come in, until the party ends, through a proxy
+ * philosopher seated past the segment's last seat. The fork is put back if
+ * the party ends while it is held on their behalf.
+ *
+ * @param party_data A pointer to the t_party struct representing the party.
+ * @return void* Always NULL, as it is a pthread routine.
+ */
+void	*serve_boundary_fork(void *party_data)
+{
+	t_philosopher	proxy;
+	struct pollfd	server;
+	char			batch[FORK_BATCH_SIZE];
+	ssize_t			size;
+	int				held;
+
+	memset(&proxy, 0, sizeof(t_philosopher));
+	proxy.party = (t_party *)party_data;
+	proxy.index = proxy.party->number_of_philosophers;
+	server.fd = proxy.party->segment.fork_server;
+	server.events = POLLIN;
+	held = 0;
+	while (party_is_over(proxy.party) == 0)
+	{
+		if (poll(&server, 1, FORK_WAIT_TIMEOUT / 1000) > 0)
+		{
+			size = read(server.fd, batch, FORK_BATCH_SIZE);
+			if (size <= 0)
+				break ;
+			handle_batch(&proxy, batch, size, &held);
+		}
+	}
+	if (held)
+		release_fork(&proxy, &(proxy.party->forks[0]));
+	return (NULL);
+}
+
+/**
+ * @brief Picks up the fork of the next segment.
+ *
+ * The request is sent to the next segment's process and the philosopher
+ * waits for the grant, checking every FORK_WAIT_TIMEOUT us whether the party
+ * has ended. A philosopher giving up sends a release right behind the
+ * request, so the fork is put back as soon as it is granted.
+ *
+ * @param philosopher A pointer to the t_philosopher struct picking the fork.
+ * @param fork A pointer to the t_fork struct standing for the remote fork.
+ * @return t_return_value SUCCESS once the fork is granted, or SOMEONE_DIED
+ * if the party ended while waiting for it.
+ */
+t_return_value	take_remote_fork(t_philosopher *philosopher, t_fork *fork)
+{
+	struct pollfd	client;
+	char			message;
+
+	message = FORK_REQUEST;
+	if (send(fork->remote, &message, 1, MSG_NOSIGNAL) != 1)
+		return (SOMEONE_DIED);
+	client.fd = fork->remote;
+	client.events = POLLIN;
+	while (party_is_over(philosopher->party) == 0)
+	{
+		if (poll(&client, 1, FORK_WAIT_TIMEOUT / 1000) > 0)
+		{
+			if (read(fork->remote, &message, 1) != 1)
+				return (SOMEONE_DIED);
+			if (message == FORK_GRANT)
+				return (SUCCESS);
+		}
+	}
+	release_remote_fork(fork);
+	return (SOMEONE_DIED);
+}
+
+/**
+ * @brief Puts the fork of the next segment back.
+ *
+ * The release is not acknowledged, so the philosopher goes on right away.
+ *
+ * @param fork A pointer to the t_fork struct standing for the remote fork.
+ */
+void	release_remote_fork(t_fork *fork)
+{
+	char	message;
+
+	message = FORK_RELEASE;
+	send(fork->remote, &message, 1, MSG_NOSIGNAL);
+}
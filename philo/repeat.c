@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   repeat.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:21:45 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 15:21:45 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Puts every seat and fork back in its initial state.
+ *
+ * Called by the main thread between the end of a run and the start of the 
+ * next one. Every other thread has then reached the rendezvous barrier that 
+ * closes the run, and touches nothing shared until the barrier that opens 
+ * the next run, which orders these writes before its reads, so no locking 
+ * is needed. The party's start time, and with it every philosopher's 
+ * time_last_ate, is stamped right before the threads are released.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ */
+static void	reset_seats(t_party *party)
+{
+	unsigned int	i;
+
+	party->someone_dead = 0;
+	party->deadlock_suspect = 0;
+	party->outcome = LIFE_GOES_ON;
+	if (party->options.scheduled)
+		prepare_schedule(party);
+	party->party_start_time = get_current_time();
+	party->round_start_time = party->party_start_time;
+	i = 0;
+	while (i < party->number_of_philosophers)
+	{
+		party->philosophers[i].meal_count = 0;
+		party->philosophers[i].min_slack = (long long)party->time_to_die;
+		party->philosophers[i].next_round = 0;
+		party->philosophers[i].time_last_ate = party->party_start_time;
+		party->forks[i].holder = NULL;
+		party->forks[i].waiter_count = 0;
+		i++;
+	}
+}
+
+/**
+ * @brief Records the results of one run.
+ *
+ * results holds three consecutive arrays of `repeat` values: the total meal 
+ * count, the death time in ms since the start and the death detection lag 
+ * in us, i.e. how long after time_last_ate + time_to_die the monitor noticed 
+ * the death. Runs without a death store NO_DEATH in the last two arrays.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @param results The results arrays.
+ * @param run The index of the run.
+ */
+static void	record_run(t_party *party, unsigned long long *results,
+		unsigned int run)
+{
+	t_philo_statistics	statistics;
+	unsigned int		runs;
+
+	runs = party->options.repeat;
+	collect_statistics(party, &statistics);
+	results[run] = statistics.total_meals;
+	results[runs + run] = NO_DEATH;
+	results[2 * runs + run] = NO_DEATH;
+	if (statistics.someone_died == 0)
+		return ;
+	results[runs + run] = statistics.death_time;
+	results[2 * runs + run] = 0;
+	if (party->death_time > party->death_deadline)
+		results[2 * runs + run] = party->death_time - party->death_deadline;
+}
+
+/**
+ * @brief Runs the same party `--repeat` times with the same threads.
+ *
+ * The philosopher and monitoring threads, the mutexes and the arrays are 
+ * created once. The main thread meets the other threads at the rendezvous 
+ * barrier to release them, and meets them again once the run is over to 
+ * record its results and reset the seats for the next run. The first run 
+ * starts from the state set up before the party's guard was released. The 
+ * distribution of the results is printed by `report_repetitions`.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return t_return_value SUCCESS, MALLOC_FAIL, THREAD_FAIL or JOIN_FAIL
+ */
+t_return_value	run_repeated_party(t_party *party)
+{
+	unsigned long long	*results;
+	unsigned int		run;
+
+	results = malloc(sizeof(unsigned long long) * 3 * party->options.repeat);
+	if (results == NULL)
+		return (MALLOC_FAIL);
+	if (start_dining_party(party) != SUCCESS)
+	{
+		free(results);
+		return (THREAD_FAIL);
+	}
+	party->joined = 1;
+	run = 0;
+	while (run < party->options.repeat)
+	{
+		barrier_wait(&(party->rendezvous));
+		barrier_wait(&(party->rendezvous));
+		record_run(party, results, run);
+		run++;
+		if (run < party->options.repeat)
+			reset_seats(party);
+	}
+	report_repetitions(party, results);
+	free(results);
+	return (join_threads_to_exit_party(party));
+}
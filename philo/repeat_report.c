@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   repeat_report.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:40:12 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 15:40:12 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Moves the values different from NO_DEATH to the front, in order.
+ *
+ * The values are sorted by insertion, which is plenty for a few hundred 
+ * runs.
+ *
+ * @param values The array of values.
+ * @param count The number of values in the array.
+ * @return unsigned int The number of values kept.
+ */
+static unsigned int	sort_values(unsigned long long *values, unsigned int count)
+{
+	unsigned int		kept;
+	unsigned int		i;
+	unsigned int		j;
+	unsigned long long	value;
+
+	kept = 0;
+	i = 0;
+	while (i < count)
+	{
+		value = values[i];
+		if (value != NO_DEATH)
+		{
+			j = kept;
+			while (j > 0 && values[j - 1] > value)
+			{
+				values[j] = values[j - 1];
+				j--;
+			}
+			values[j] = value;
+			kept++;
+		}
+		i++;
+	}
+	return (kept);
+}
+
+/**
+ * @brief Prints the minimum, median and maximum of a results array.
+ *
+ * @param label The name of the measured quantity.
+ * @param values The array of values, reordered by this function.
+ * @param count The number of values in the array.
+ */
+static void	print_distribution(const char *label, unsigned long long *values,
+		unsigned int count)
+{
+	count = sort_values(values, count);
+	if (count == 0)
+	{
+		fprintf(stderr, "%s\tmin -\tmedian -\tmax -\n", label);
+		return ;
+	}
+	fprintf(stderr, "%s\tmin %llu\tmedian %llu\tmax %llu\n", label, values[0],
+		values[count / 2], values[count - 1]);
+}
+
+/**
+ * @brief Prints the distribution of the results of a `--repeat` session.
+ *
+ * The report goes to stderr, so the event log on stdout stays untouched. 
+ * The death time and detection lag lines only account for the runs in 
+ * which someone died.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @param results The results arrays filled by `record_run`.
+ */
+void	report_repetitions(t_party *party, unsigned long long *results)
+{
+	unsigned int	runs;
+	unsigned int	deaths;
+	unsigned int	i;
+
+	runs = party->options.repeat;
+	deaths = 0;
+	i = 0;
+	while (i < runs)
+		deaths += (results[runs + i++] != NO_DEATH);
+	fprintf(stderr, "repeat\truns %u\tdeaths %u\n", runs, deaths);
+	print_distribution("meals", results, runs);
+	print_distribution("death time (ms)", results + runs, runs);
+	print_distribution("detection lag (us)", results + 2 * runs, runs);
+}
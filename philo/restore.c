@@ -0,0 +1,173 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   restore.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 23:24:50 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 23:24:50 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Prepares the checkpoint and restore of a party.
+ *
+ * With `--checkpoint FILE` or `--checkpoint-at MS`, the seats of the
+ * snapshot are allocated ahead, and SIGUSR1 is blocked in the main thread
+ * before any thread is created: every thread inherits the mask, and the
+ * monitor picks the signal up with `check_checkpoint` instead of a handler.
+ * With `--restore FILE`, the snapshot is loaded by `load_checkpoint`.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return t_return_value SUCCESS, MALLOC_FAIL or ERROR
+ */
+t_return_value	prepare_checkpoint(t_party *party)
+{
+	sigset_t	signals;
+
+	if (party->options.checkpoint_at && party->options.checkpoint_file == NULL)
+		party->options.checkpoint_file = CHECKPOINT_DEFAULT_FILE;
+	if (party->options.checkpoint_file != NULL)
+	{
+		party->checkpoint = malloc(sizeof(t_checkpoint_seat)
+				* party->number_of_philosophers);
+		if (party->checkpoint == NULL)
+			return (MALLOC_FAIL);
+		sigemptyset(&signals);
+		sigaddset(&signals, SIGUSR1);
+		pthread_sigmask(SIG_BLOCK, &signals, NULL);
+	}
+	if (party->options.restore_file != NULL)
+		return (load_checkpoint(party));
+	return (SUCCESS);
+}
+
+/**
+ * @brief Checks that a snapshot was taken on the same table.
+ *
+ * The number of philosophers and the three times must match the
+ * command-line; the number of meals may differ, to let a restored party
+ * run longer or shorter than the original one.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @param header A pointer to the t_checkpoint_header read from the file.
+ * @return int 1 if the snapshot fits the table, 0 otherwise.
+ */
+static int	header_matches(t_party *party, t_checkpoint_header *header)
+{
+	return (memcmp(header->magic, CHECKPOINT_MAGIC, sizeof(header->magic)) == 0
+		&& header->number_of_philosophers == party->number_of_philosophers
+		&& header->time_to_die == party->time_to_die
+		&& header->time_to_eat == party->time_to_eat
+		&& header->time_to_sleep == party->time_to_sleep);
+}
+
+/**
+ * @brief Checks that every seat of a snapshot is a possible state.
+ *
+ * A philosopher takes their own fork first, so a seat holding one fork
+ * holds its own, and a seat holding two also holds the next seat's. Two
+ * forks on a seat thus leave the next seat none, and an eating seat holds
+ * both of its forks. Otherwise `claim_restored_forks` would have two
+ * threads claim one fork.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return int 1 if every seat is valid, 0 otherwise.
+ */
+static int	seats_are_valid(t_party *party)
+{
+	unsigned int		i;
+	t_checkpoint_seat	*seat;
+	t_checkpoint_seat	*next;
+
+	i = 0;
+	while (i < party->number_of_philosophers)
+	{
+		seat = &(party->restored[i]);
+		next = &(party->restored[(i + 1) % party->number_of_philosophers]);
+		if (seat->activity > PHILO_THINKING || seat->forks_held > 2
+			|| (seat->forks_held > 0 && seat->activity != PHILO_TOOK_FORK
+				&& seat->activity != PHILO_EATING)
+			|| (seat->activity == PHILO_EATING && seat->forks_held != 2)
+			|| (seat->forks_held == 2 && next->forks_held > 0)
+			|| seat->since_ate > party->restored_time)
+			return (0);
+		i++;
+	}
+	return (1);
+}
+
+/**
+ * @brief Loads the snapshot of `--restore FILE`.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return t_return_value SUCCESS, MALLOC_FAIL or ERROR if the file cannot be
+ * read or was not taken on this table.
+ */
+t_return_value	load_checkpoint(t_party *party)
+{
+	t_checkpoint_header	header;
+	FILE				*file;
+	int					loaded;
+
+	party->restored = malloc(sizeof(t_checkpoint_seat)
+			* party->number_of_philosophers);
+	if (party->restored == NULL)
+		return (MALLOC_FAIL);
+	file = fopen(party->options.restore_file, "rb");
+	loaded = (file != NULL && fread(&header, sizeof(header), 1, file) == 1
+			&& header_matches(party, &header)
+			&& fread(party->restored, sizeof(t_checkpoint_seat),
+				party->number_of_philosophers, file)
+			== party->number_of_philosophers);
+	if (file != NULL)
+		fclose(file);
+	if (loaded)
+		party->restored_time = header.time;
+	if (loaded == 0 || seats_are_valid(party) == 0)
+	{
+		printf("Checkpoint %s cannot be restored on this table\n\n",
+			party->options.restore_file);
+		return (ERROR);
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @brief Puts the party back in the state of the snapshot.
+ *
+ * Called once the start time is set: the party's clock is moved back by
+ * the time of the snapshot, so the log carries on from it, and each
+ * philosopher gets back their meals, the start of their last meal and of
+ * their activity, relative to that clock.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ */
+void	apply_restore(t_party *party)
+{
+	unsigned long long	now;
+	unsigned int		i;
+	t_philosopher		*philosopher;
+	t_checkpoint_seat	*seat;
+
+	now = party->party_start_time;
+	party->party_start_time = now - party->restored_time;
+	party->round_start_time = party->party_start_time;
+	i = 0;
+	while (i < party->number_of_philosophers)
+	{
+		philosopher = &(party->philosophers[i]);
+		seat = &(party->restored[i]);
+		philosopher->time_last_ate = now - seat->since_ate;
+		philosopher->last_meal_logged = philosopher->time_last_ate;
+		philosopher->meal_count = seat->meal_count;
+		philosopher->activity_meals = seat->meal_count;
+		philosopher->activity = seat->activity;
+		philosopher->activity_since = now - seat->elapsed;
+		philosopher->forks_held = seat->forks_held;
+		i++;
+	}
+}
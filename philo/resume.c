@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   resume.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 23:48:12 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 23:48:12 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Picks up the forks a philosopher held in the snapshot.
+ *
+ * Called by the philosopher's thread before the party starts, while the
+ * other threads wait for the guard mutex: the forks are free, so they are
+ * taken right away and by the thread that will put them back. The first
+ * fork taken is always the philosopher's own.
+ *
+ * @param philosopher A pointer to the t_philosopher struct.
+ */
+void	claim_restored_forks(t_philosopher *philosopher)
+{
+	t_checkpoint_seat	*seat;
+
+	if (philosopher->party->restored == NULL)
+		return ;
+	seat = &(philosopher->party->restored[philosopher->index]);
+	if (seat->forks_held >= 1)
+		take_fork(philosopher, philosopher->fork_own);
+	if (seat->forks_held >= 2)
+		take_fork(philosopher, philosopher->fork_borrowed);
+}
+
+/**
+ * @brief Starts the meal of a philosopher caught holding forks.
+ *
+ * The missing fork is taken, then the meal starts as in `eat`.
+ *
+ * @param philosopher A pointer to the t_philosopher struct.
+ * @param seat A pointer to the philosopher's t_checkpoint_seat.
+ * @return t_return_value SUCCESS or SOMEONE_DIED
+ */
+static t_return_value	start_meal(t_philosopher *philosopher,
+		t_checkpoint_seat *seat)
+{
+	if (seat->forks_held < 2)
+	{
+		if (take_fork(philosopher, philosopher->fork_borrowed) != SUCCESS)
+		{
+			release_fork(philosopher, philosopher->fork_own);
+			return (SOMEONE_DIED);
+		}
+		print_whats_happening(philosopher, PHILO_TOOK_FORK);
+	}
+	pthread_mutex_lock(&philosopher->meal_update);
+	record_meal_start(philosopher);
+	pthread_mutex_unlock(&philosopher->meal_update);
+	print_whats_happening(philosopher, PHILO_EATING);
+	return (SUCCESS);
+}
+
+/**
+ * @brief Finishes the meal that the snapshot interrupted.
+ *
+ * A philosopher caught eating eats for what is left of time_to_eat. One
+ * caught with one or two forks starts a whole meal with `start_meal`.
+ * Either way the forks are then put back and the meal is counted.
+ *
+ * @param philosopher A pointer to the t_philosopher struct.
+ * @param seat A pointer to the philosopher's t_checkpoint_seat.
+ * @return t_return_value SUCCESS or SOMEONE_DIED
+ */
+static t_return_value	finish_meal(t_philosopher *philosopher,
+		t_checkpoint_seat *seat)
+{
+	unsigned long long	left;
+
+	left = philosopher->party->time_to_eat;
+	if (seat->activity == PHILO_EATING && seat->elapsed < left)
+		left -= seat->elapsed;
+	else if (seat->activity == PHILO_EATING)
+		left = 0;
+	else if (start_meal(philosopher, seat) != SUCCESS)
+		return (SOMEONE_DIED);
+	custom_usleep(left, philosopher);
+	release_fork(philosopher, philosopher->fork_own);
+	release_fork(philosopher, philosopher->fork_borrowed);
+	pthread_mutex_lock(&philosopher->meal_update);
+	philosopher->meal_count++;
+	pthread_mutex_unlock(&philosopher->meal_update);
+	return (SUCCESS);
+}
+
+/**
+ * @brief Carries on with the activity of the snapshot, on `--restore`.
+ *
+ * Replaces the first thought and the offset of the even seats at the start
+ * of a party: a thinking philosopher goes straight to the table, a sleeping
+ * one sleeps what is left of time_to_sleep and an eating one, or one
+ * holding forks, finishes the meal with `finish_meal` and sleeps. What was
+ * logged before the snapshot is not logged again.
+ *
+ * @param philosopher A pointer to the t_philosopher struct.
+ * @return int 1 if the party was restored, 0 for a party started afresh.
+ */
+int	resume_activity(t_philosopher *philosopher)
+{
+	t_checkpoint_seat	*seat;
+	unsigned long long	sleep_left;
+
+	if (philosopher->party->restored == NULL)
+		return (0);
+	seat = &(philosopher->party->restored[philosopher->index]);
+	if (seat->activity == PHILO_THINKING)
+		return (1);
+	sleep_left = philosopher->party->time_to_sleep;
+	if (seat->activity == PHILO_SLEEPING && seat->elapsed < sleep_left)
+		sleep_left -= seat->elapsed;
+	else if (seat->activity == PHILO_SLEEPING)
+		sleep_left = 0;
+	else if (finish_meal(philosopher, seat) != SUCCESS)
+		return (1);
+	else
+		print_whats_happening(philosopher, PHILO_SLEEPING);
+	custom_usleep(sleep_left, philosopher);
+	print_whats_happening(philosopher, PHILO_THINKING);
+	return (1);
+}
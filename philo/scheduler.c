@@ -0,0 +1,170 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scheduler.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:31:02 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 09:31:02 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Counts the philosophers scheduled to eat in a given round.
+ *
+ * @param party A pointer to the t_party struct holding the schedule.
+ * @param round The round index, in the range [0, schedule_rounds).
+ * @return unsigned int The number of eaters of that round.
+ */
+static unsigned int	count_round_eaters(t_party *party, unsigned int round)
+{
+	unsigned int	i;
+	unsigned int	eaters;
+
+	i = 0;
+	eaters = 0;
+	while (i < party->number_of_philosophers)
+	{
+		eaters += party->schedule[round * party->number_of_philosophers + i];
+		i++;
+	}
+	return (eaters);
+}
+
+/**
+ * @brief Precomputes the conflict-free eating rounds of the table.
+ *
+ * Philosophers sharing a fork are neighbours on a ring, so every round must
+ * be an independent set of that ring. With an even number of seats the ring
+ * is 2-colourable and the two colour classes (even and odd seats) alternate.
+ * With an odd number of seats, round r feeds the seats r, r + 2, ...,
+ * r + N - 3 (modulo N): each round holds the maximum of floor(N / 2) eaters,
+ * the N rounds rotate the single idle gap around the table so every seat
+ * eats (N - 1) / 2 times per cycle, and no seat eats in two consecutive
+ * rounds. The result is stored as a rounds x seats table of 0/1 entries, 
+ * allocated on the first call only, and the table is rewound to round 0.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return t_return_value SUCCESS or MALLOC_FAIL
+ */
+t_return_value	prepare_schedule(t_party *party)
+{
+	unsigned int	n;
+	unsigned int	round;
+	unsigned int	i;
+
+	n = party->number_of_philosophers;
+	party->schedule_rounds = n;
+	if (n % 2 == 0)
+		party->schedule_rounds = 2;
+	if (party->schedule == NULL)
+		party->schedule = malloc(party->schedule_rounds * n);
+	if (party->schedule == NULL)
+		return (MALLOC_FAIL);
+	round = 0;
+	while (round < party->schedule_rounds)
+	{
+		i = 0;
+		while (i < n)
+		{
+			party->schedule[round * n + i] = ((i + n - round) % n % 2 == 0
+					&& (n % 2 == 0 || (i + n - round) % n < n - 1));
+			i++;
+		}
+		round++;
+	}
+	party->round_serial = 0;
+	party->round_eaters_left = count_round_eaters(party, 0);
+	return (SUCCESS);
+}
+
+/**
+ * @brief Moves the table to the next round once the current one is over.
+ *
+ * A round is over when all of its eaters have started their meal and 
+ * time_to_eat has elapsed since the round began. Clocking the rounds on the 
+ * meal start rather than on the slowest meal end keeps wake-up lag from 
+ * accumulating round after round; a late eater of the previous round only 
+ * delays the neighbour waiting on its fork. Must be called with the party's 
+ * scheduling mutex held.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ */
+static void	advance_round_if_due(t_party *party)
+{
+	unsigned long long	now;
+
+	if (party->round_eaters_left != 0)
+		return ;
+	now = get_current_time();
+	if (now - party->round_start_time < party->time_to_eat)
+		return ;
+	party->round_serial++;
+	party->round_start_time = now;
+	party->round_eaters_left = count_round_eaters(party,
+			party->round_serial % party->schedule_rounds);
+}
+
+/**
+ * @brief Claims the philosopher's slot if the current round feeds them.
+ *
+ * Must be called with the party's scheduling mutex held.
+ *
+ * @param philosopher A pointer to the t_philosopher struct.
+ * @return int 1 if the current round feeds this philosopher and they have
+ * not eaten in it yet, 0 otherwise.
+ */
+static int	claim_turn(t_philosopher *philosopher)
+{
+	t_party			*party;
+	unsigned int	round;
+
+	party = philosopher->party;
+	advance_round_if_due(party);
+	round = party->round_serial % party->schedule_rounds;
+	if (party->round_serial < philosopher->next_round
+		|| party->schedule[round * party->number_of_philosophers
+			+ philosopher->index] == 0)
+		return (0);
+	philosopher->next_round = party->round_serial + 1;
+	party->round_eaters_left--;
+	return (1);
+}
+
+/**
+ * @brief Waits until the schedule hands the philosopher an eating slot.
+ *
+ * The philosopher polls the round counter every TURN_POLL_INTERVAL us until
+ * the current round includes their seat. Since every round is an independent
+ * set, both forks are uncontended once this function returns SUCCESS.
+ *
+ * @param philosopher A pointer to the t_philosopher struct.
+ * @return t_return_value SUCCESS once it is the philosopher's turn, or
+ * SOMEONE_DIED if the party ended while waiting.
+ */
+t_return_value	wait_for_turn(t_philosopher *philosopher)
+{
+	t_party	*party;
+	int		my_turn;
+
+	party = philosopher->party;
+	while (1)
+	{
+		pthread_mutex_lock(&(party->scheduling));
+		my_turn = claim_turn(philosopher);
+		pthread_mutex_unlock(&(party->scheduling));
+		if (my_turn)
+			return (SUCCESS);
+		pthread_mutex_lock(&(party->dying));
+		if (party->someone_dead != 0)
+		{
+			pthread_mutex_unlock(&(party->dying));
+			return (SOMEONE_DIED);
+		}
+		pthread_mutex_unlock(&(party->dying));
+		usleep(TURN_POLL_INTERVAL);
+	}
+}
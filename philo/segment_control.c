@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   segment_control.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:21:37 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 15:21:37 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Sends a control message over a segment's control socket.
+ *
+ * Control sockets are SOCK_SEQPACKET, so each message arrives whole.
+ *
+ * @param socket The control socket.
+ * @param type The type of the message.
+ * @param seat The seat concerned, on the whole table, if any.
+ * @param value The payload of the message: a time, an outcome or a count.
+ * @return int 1 if the message was sent, 0 otherwise.
+ */
+int	send_segment_message(int socket, t_segment_message_type type,
+		unsigned int seat, unsigned long long value)
+{
+	t_segment_message	message;
+
+	memset(&message, 0, sizeof(t_segment_message));
+	message.type = type;
+	message.seat = seat;
+	message.value = value;
+	return (send(socket, &message, sizeof(t_segment_message), MSG_NOSIGNAL)
+		== sizeof(t_segment_message));
+}
+
+/**
+ * @brief Waits for the coordinator's answer to a death claim.
+ *
+ * A stop instead of a grant is acknowledged right away.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return int 1 if the death was granted, 0 otherwise.
+ */
+static int	await_death_grant(t_party *party)
+{
+	t_segment_message	message;
+
+	while (recv(party->segment.control, &message, sizeof(t_segment_message),
+			0) == sizeof(t_segment_message))
+	{
+		if (message.type == SEGMENT_PRINT)
+			return (1);
+		if (message.type == SEGMENT_STOP)
+		{
+			send_segment_message(party->segment.control, SEGMENT_ACK, 0, 0);
+			return (0);
+		}
+	}
+	return (0);
+}
+
+/**
+ * @brief Asks the coordinator whether a death of this segment is printed.
+ *
+ * Called by the monitor with the party's dying mutex held, and returns with
+ * it held. The party is ended first, so the segment prints nothing else,
+ * then the mutex is let go while the claim travels: the philosophers' last
+ * prints and sleeps do not wait for the coordinator. The coordinator stops
+ * every other segment and only grants the death once they have all
+ * acknowledged, so no line of the table is printed after it. If another
+ * segment's death or the end of the table got there first, the segment is
+ * stopped instead and the death is not printed. Always granted when the
+ * party is a whole table.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @param i The index of the starved philosopher within the segment.
+ * @return int 1 if the death must be printed, 0 otherwise.
+ */
+int	segment_claims_death(t_party *party, unsigned int i)
+{
+	int	granted;
+
+	if (party->segment.count <= 1)
+		return (1);
+	party->someone_dead = 1;
+	if (send_segment_message(party->segment.control, SEGMENT_DIED,
+			party->segment.first_seat + i, party->death_time) == 0)
+		return (0);
+	pthread_mutex_unlock(&(party->dying));
+	granted = await_death_grant(party);
+	pthread_mutex_lock(&(party->dying));
+	return (granted);
+}
+
+/**
+ * @brief Checks without blocking whether the coordinator stopped the table.
+ *
+ * Called by the monitor with the party's dying mutex held. On a stop, the
+ * party is ended with the outcome of the whole table before the stop is
+ * acknowledged, so the segment prints nothing after the acknowledgement. A
+ * coordinator gone away also ends the party.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return int 1 if the party was stopped, 0 otherwise.
+ */
+int	segment_was_stopped(t_party *party)
+{
+	t_segment_message	message;
+	ssize_t				size;
+
+	size = recv(party->segment.control, &message, sizeof(t_segment_message),
+			MSG_DONTWAIT);
+	if (size < 0 || (size > 0 && message.type != SEGMENT_STOP))
+		return (0);
+	party->someone_dead = 1;
+	party->outcome = ERROR;
+	if (size == 0)
+		return (1);
+	party->outcome = (t_return_value)message.value;
+	send_segment_message(party->segment.control, SEGMENT_ACK, 0, 0);
+	return (1);
+}
+
+/**
+ * @brief Reports to the coordinator that every seat of the segment is fed.
+ *
+ * The report is sent once; the segment keeps dining until the coordinator
+ * stops the table, once every segment has reported.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return t_return_value Always LIFE_GOES_ON.
+ */
+t_return_value	report_segment_fed(t_party *party)
+{
+	if (party->segment.fed_reported == 0)
+	{
+		send_segment_message(party->segment.control, SEGMENT_FED, 0, 0);
+		party->segment.fed_reported = 1;
+	}
+	return (LIFE_GOES_ON);
+}
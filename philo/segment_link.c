@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   segment_link.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:34:02 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 15:34:02 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Links a segment to the rest of the table before its party starts.
+ *
+ * Called once the segment's philosophers are created. It starts the thread
+ * serving the segment's first fork to the previous segment, reports to the
+ * coordinator that the segment is ready and waits until every segment is,
+ * taking the table's start time from the coordinator's go.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return t_return_value SUCCESS, or THREAD_FAIL if the server thread could
+ * not be created or the table was stopped before it started.
+ */
+t_return_value	join_segments(t_party *party)
+{
+	t_segment_message	message;
+
+	if (pthread_create(&(party->segment.server_thread),
+			&(party->thread_attributes), serve_boundary_fork, party) != 0)
+	{
+		printf("Failed to create a fork server thread\n");
+		return (THREAD_FAIL);
+	}
+	party->segment.server_started = 1;
+	if (send_segment_message(party->segment.control, SEGMENT_READY,
+			party->segment.first_seat, 0) == 0
+		|| recv(party->segment.control, &message, sizeof(t_segment_message), 0)
+		!= sizeof(t_segment_message) || message.type != SEGMENT_GO)
+		return (THREAD_FAIL);
+	party->segment.start_time = message.value;
+	return (SUCCESS);
+}
+
+/**
+ * @brief Unlinks a segment from the table once its party is over.
+ *
+ * The fork server thread is joined and, if the party ran, the segment's
+ * meal count is sent to the coordinator for the table's statistics.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @param ret_val The result of the segment's party.
+ */
+void	leave_segments(t_party *party, t_return_value ret_val)
+{
+	t_philo_statistics	statistics;
+
+	if (party->segment.server_started)
+		pthread_join(party->segment.server_thread, NULL);
+	if (ret_val != SUCCESS)
+		return ;
+	collect_statistics(party, &statistics);
+	send_segment_message(party->segment.control, SEGMENT_MEALS,
+		party->segment.first_seat, statistics.total_meals);
+}
+
+/**
+ * @brief Opens the sockets linking the coordinator and the segments.
+ *
+ * For each segment s, links[2s] and links[2s + 1] are the coordinator's and 
+ * the segment's ends of its control socket, a SOCK_SEQPACKET socket carrying 
+ * t_segment_message. links[2P + 2s] and links[2P + 2s + 1] are a byte stream 
+ * carrying the fork messages of the boundary between segment s, which 
+ * borrows the fork, and segment s + 1, which serves it.
+ *
+ * @param links An array of 4 * count sockets to fill.
+ * @param count The number of segments P.
+ * @return t_return_value SUCCESS or ERROR
+ */
+t_return_value	open_segment_links(int *links, unsigned int count)
+{
+	unsigned int	s;
+
+	s = 0;
+	while (s < 4 * count)
+		links[s++] = -1;
+	s = 0;
+	while (s < count)
+	{
+		if (socketpair(AF_UNIX, SOCK_SEQPACKET, 0, links + 2 * s) != 0
+			|| socketpair(AF_UNIX, SOCK_STREAM, 0, links + 2 * count + 2 * s)
+			!= 0)
+		{
+			printf("Failed to open the segment sockets\n");
+			return (ERROR);
+		}
+		s++;
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @brief Closes the sockets a process does not use.
+ *
+ * The coordinator keeps its end of every control socket. A segment keeps 
+ * its end of its control socket, the fork stream to the next segment and 
+ * the fork stream from the previous one.
+ *
+ * @param links The array of 4 * count sockets from `open_segment_links`.
+ * @param count The number of segments P.
+ * @param keeper The index of the segment, or count for the coordinator.
+ */
+void	keep_segment_links(int *links, unsigned int count, unsigned int keeper)
+{
+	unsigned int	i;
+	unsigned int	server;
+	int				kept;
+
+	server = 2 * count + 2 * ((keeper + count - 1) % count) + 1;
+	i = 0;
+	while (i < 4 * count)
+	{
+		kept = (keeper == count && i < 2 * count && i % 2 == 0);
+		if (keeper < count)
+			kept = (i == 2 * keeper + 1 || i == 2 * count + 2 * keeper
+					|| i == server);
+		if (kept == 0 && links[i] >= 0)
+			close(links[i]);
+		i++;
+	}
+}
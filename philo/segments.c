@@ -0,0 +1,168 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   segments.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:05:51 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 16:05:51 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Runs one segment of the table, in its own process.
+ *
+ * Segment s gets the seats [s * N / P, (s + 1) * N / P) of the table and
+ * runs them as an ordinary party of that many philosophers, whose last
+ * borrowed fork is the first fork of the next segment, reached through its
+ * fork stream. Its own first fork is served to the previous segment.
+ *
+ * @param party A pointer to the t_party struct holding the parsed arguments.
+ * @param links The array of sockets from `open_segment_links`.
+ * @param s The index of the segment.
+ * @return t_return_value The result of the segment's party.
+ */
+static t_return_value	run_segment(t_party *party, int *links, unsigned int s)
+{
+	unsigned int	count;
+	unsigned int	table;
+	t_return_value	ret_val;
+
+	count = party->options.segments;
+	table = party->number_of_philosophers;
+	keep_segment_links(links, count, s);
+	party->number_of_philosophers = (s + 1) * table / count
+		- s * table / count;
+	ret_val = prepare_party(party);
+	if (ret_val != SUCCESS)
+		return (ret_val);
+	party->segment.index = s;
+	party->segment.count = count;
+	party->segment.first_seat = s * table / count;
+	party->segment.control = links[2 * s + 1];
+	party->segment.fork_server = links[2 * count
+		+ 2 * ((s + count - 1) % count) + 1];
+	party->forks[party->number_of_philosophers].remote = links[2 * count
+		+ 2 * s];
+	ret_val = run_dining_party(party);
+	leave_segments(party, ret_val);
+	clean_up(party);
+	free(links);
+	return (ret_val);
+}
+
+/**
+ * @brief Forks one process per segment.
+ *
+ * Each child runs its segment and exits with its result. The coordinator
+ * watches the control socket of every segment started; a segment that
+ * could not be started is left out, which stops the table right away.
+ *
+ * @param party A pointer to the t_party struct holding the parsed arguments.
+ * @param links The array of sockets from `open_segment_links`.
+ * @param coordinator A pointer to the t_coordinator struct to set up.
+ */
+static void	start_segments(t_party *party, int *links,
+		t_coordinator *coordinator)
+{
+	unsigned int	s;
+	pid_t			pid;
+
+	s = 0;
+	while (s < coordinator->count)
+	{
+		coordinator->segments[s].fd = -1;
+		coordinator->segments[s].events = POLLIN;
+		coordinator->quiet[s] = 1;
+		pid = fork();
+		if (pid == 0)
+			exit(run_segment(party, links, s));
+		if (pid > 0)
+		{
+			coordinator->segments[s].fd = links[2 * s];
+			coordinator->quiet[s] = 0;
+			coordinator->open++;
+		}
+		else
+			printf("Failed to start segment %u\n", s + 1);
+		s++;
+	}
+	keep_segment_links(links, coordinator->count, coordinator->count);
+}
+
+/**
+ * @brief Prints the throughput of the whole table.
+ *
+ * With `--stats`, the meals reported by every segment are added up over the
+ * time from the coordinator's go to the end of the table, next to the
+ * floor(N / 2) theoretical bound.
+ *
+ * @param party A pointer to the t_party struct holding the parsed arguments.
+ * @param coordinator A pointer to the t_coordinator struct of the table.
+ */
+static void	report_table(t_party *party, t_coordinator *coordinator)
+{
+	double	duration;
+
+	if (party->options.stats == 0 || coordinator->start_time == 0)
+		return ;
+	duration = (coordinator->end_time - coordinator->start_time) / 1e6;
+	if (duration <= 0)
+		duration = 1e-6;
+	fprintf(stderr, "stats\tsegments %u\tmeals %llu\tduration %.3f s\t"
+		"meals/s %.2f\tbound %.2f\n", coordinator->count, coordinator->meals,
+		duration, coordinator->meals / duration,
+		(party->number_of_philosophers / 2) * 1e6 / party->time_to_eat);
+}
+
+/**
+ * @brief Runs the table as `--segments P` processes linked by sockets.
+ *
+ * The ring is cut into P segments of consecutive seats, each run by its own
+ * process with the ordinary party machinery. This process becomes the
+ * coordinator of the table (see `coordinate_segments`) and waits for every
+ * segment to exit. stdout is line buffered so that the lines of the
+ * segments reach the shared log in the order they are printed.
+ *
+ * @param party A pointer to the t_party struct holding the parsed arguments.
+ * @return t_return_value SUCCESS once the table ended with a death or with
+ * everyone fed, MALLOC_FAIL, ERROR or THREAD_FAIL otherwise.
+ */
+t_return_value	run_segmented_table(t_party *party)
+{
+	t_coordinator	coordinator;
+	int				*links;
+	int				status;
+	t_return_value	ret_val;
+
+	memset(&coordinator, 0, sizeof(t_coordinator));
+	coordinator.count = party->options.segments;
+	coordinator.winner = -1;
+	links = malloc(sizeof(int) * 4 * coordinator.count);
+	coordinator.segments = malloc(sizeof(struct pollfd) * coordinator.count);
+	coordinator.quiet = malloc(coordinator.count);
+	ret_val = MALLOC_FAIL;
+	if (links && coordinator.segments && coordinator.quiet)
+		ret_val = open_segment_links(links, coordinator.count);
+	if (ret_val == SUCCESS)
+	{
+		setvbuf(stdout, NULL, _IOLBF, 0);
+		start_segments(party, links, &coordinator);
+		coordinate_segments(&coordinator);
+		while (wait(&status) > 0)
+		{
+			if (WIFEXITED(status) == 0 || WEXITSTATUS(status) != SUCCESS)
+				ret_val = THREAD_FAIL;
+		}
+		if (coordinator.outcome == ERROR)
+			ret_val = ERROR;
+		report_table(party, &coordinator);
+	}
+	free(links);
+	free(coordinator.segments);
+	free(coordinator.quiet);
+	return (ret_val);
+}
@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:05:31 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 16:05:31 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Creates the philosopher threads one after the other.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return t_return_value SUCCESS or THREAD_FAIL
+ */
+static t_return_value	spawn_serially(t_party *party)
+{
+	unsigned int	i;
+
+	i = 0;
+	while (i < party->number_of_philosophers)
+	{
+		if (start_philosopher(party, i) == THREAD_FAIL)
+			return (THREAD_FAIL);
+		i++;
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @brief Creates the children of a philosopher in the spawn tree.
+ *
+ * Seats form a binary tree rooted at seat 0: seat i creates seats 2i + 1 
+ * and 2i + 2, so the N threads are created in O(log N) rounds of parallel 
+ * pthread_create calls instead of N serial ones. Once done, the philosopher 
+ * reports to the main thread waiting in `spawn_philosophers`. Does nothing 
+ * with `--serial-spawn`, where the main thread creates every philosopher.
+ *
+ * @param philosopher A pointer to the t_philosopher struct.
+ */
+void	spawn_children(t_philosopher *philosopher)
+{
+	t_party			*party;
+	unsigned int	child;
+
+	party = philosopher->party;
+	if (party->options.serial_spawn)
+		return ;
+	child = 2 * philosopher->index + 1;
+	while (child <= 2 * philosopher->index + 2
+		&& child < party->number_of_philosophers)
+	{
+		start_philosopher(party, child);
+		child++;
+	}
+	pthread_mutex_lock(&(party->spawning));
+	party->threads_reported++;
+	pthread_cond_broadcast(&(party->spawn_reported));
+	pthread_mutex_unlock(&(party->spawning));
+}
+
+/**
+ * @brief Creates the philosopher threads.
+ *
+ * By default the main thread only creates the root of the spawn tree and 
+ * waits until every created philosopher has reported that they have created 
+ * their own children (see `spawn_children`). A failed creation cuts a 
+ * subtree off, which shows as fewer threads started than philosophers. 
+ * With `--serial-spawn` the main thread creates every thread itself.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return t_return_value SUCCESS or THREAD_FAIL
+ */
+t_return_value	spawn_philosophers(t_party *party)
+{
+	int	complete;
+
+	if (party->options.serial_spawn)
+		return (spawn_serially(party));
+	if (start_philosopher(party, 0) == THREAD_FAIL)
+		return (THREAD_FAIL);
+	pthread_mutex_lock(&(party->spawning));
+	while (party->threads_reported < party->threads_started)
+		pthread_cond_wait(&(party->spawn_reported), &(party->spawning));
+	complete = (party->threads_started == party->number_of_philosophers);
+	pthread_mutex_unlock(&(party->spawning));
+	if (complete == 0)
+		return (THREAD_FAIL);
+	return (SUCCESS);
+}
@@ -11,13 +11,85 @@
 /* ************************************************************************** */
 
 #include "philosophers.h"
+
+/**
+ * @brief Prepares the attributes and the bookkeeping of thread creation.
+ *
+ * The threads get a small stack, DEFAULT_STACK_SIZE or `--stack-size` KiB, 
+ * instead of the 8 MiB default of the C library, since their routines only 
+ * need a few KiB. The size is raised to PTHREAD_STACK_MIN if needed and 
+ * rounded up to whole pages, and a one page guard still catches overflows. 
+ * The spawning mutex and condition variable let the threads report their 
+ * own creation of further threads. party->prepared.spawning counts the 
+ * attributes, mutex and condition variable initialized, in this order.
+ *
+ * @param party The party struct containing information about the philosophers.
+ * @return t_return_value SUCCESS, THREAD_FAIL or MUTEX_FAIL
+ */
+t_return_value	prepare_thread_spawning(t_party *party)
+{
+	size_t	stack_size;
+	size_t	page_size;
+
+	page_size = (size_t)sysconf(_SC_PAGESIZE);
+	stack_size = (size_t)party->options.stack_size * 1024;
+	if (stack_size == 0)
+		stack_size = DEFAULT_STACK_SIZE;
+	if (stack_size < (size_t)PTHREAD_STACK_MIN)
+		stack_size = (size_t)PTHREAD_STACK_MIN;
+	stack_size = (stack_size + page_size - 1) / page_size * page_size;
+	if (pthread_attr_init(&(party->thread_attributes)) != 0)
+		return (THREAD_FAIL);
+	party->prepared.spawning++;
+	if (pthread_attr_setstacksize(&(party->thread_attributes), stack_size) != 0
+		|| pthread_attr_setguardsize(&(party->thread_attributes),
+			page_size) != 0)
+		return (THREAD_FAIL);
+	if (pthread_mutex_init(&(party->spawning), NULL) != SUCCESS)
+		return (MUTEX_FAIL);
+	party->prepared.spawning++;
+	if (pthread_cond_init(&(party->spawn_reported), NULL) != SUCCESS)
+		return (MUTEX_FAIL);
+	party->prepared.spawning++;
+	return (SUCCESS);
+}
+
+/**
+ * @brief Prepares attributes for threads under the default policy.
+ *
+ * Threads created with them run under SCHED_OTHER, whatever the policy of
+ * the creating thread, which `--realtime` moves to SCHED_FIFO. The
+ * priority must be set as well: it would otherwise be inherited too.
+ *
+ * @param attributes A pointer to the pthread_attr_t to initialize.
+ * @return t_return_value SUCCESS or THREAD_FAIL
+ */
+t_return_value	init_default_policy(pthread_attr_t *attributes)
+{
+	struct sched_param	param;
+
+	if (pthread_attr_init(attributes) != 0)
+		return (THREAD_FAIL);
+	memset(&param, 0, sizeof(param));
+	if (pthread_attr_setinheritsched(attributes, PTHREAD_EXPLICIT_SCHED) == 0
+		&& pthread_attr_setschedpolicy(attributes, SCHED_OTHER) == 0
+		&& pthread_attr_setschedparam(attributes, &param) == 0)
+		return (SUCCESS);
+	pthread_attr_destroy(attributes);
+	return (THREAD_FAIL);
+}
+
 /**
  * @brief Create and start a philosopher thread.
  *
  * This function creates a new thread for a philosopher in the given party.
- * The philosopher's index is set, and the `philosopher_routine` function is
- * assigned as the entry point for the thread. The philosopher's data is 
- * passed as an argument to the thread.
+ * The `philosopher_routine` function is assigned as the entry point for the 
+ * thread, which gets the party's small-stack thread attributes. The 
+ * philosopher's data is passed as an argument to the thread. Creations are 
+ * counted under the party's spawning mutex, since threads may be created by 
+ * other philosophers. The count is taken before pthread_create, so a new 
+ * thread can never report to `spawn_philosophers` before it is counted, and 
+ * is withdrawn if the creation fails.
  *
  * @param party The party struct containing information about the philosophers.
  * @param i The index of the philosopher to create and start the thread for.
@@ -26,10 +98,18 @@
  */
 t_return_value	start_philosopher(t_party	*party, unsigned int i)
 {
-	party->philosophers[i].index = i;
-	if (pthread_create(&(party->philosophers[i].thread), NULL, \
-		philosopher_routine, (void *)&(party->philosophers[i])) != 0)
+	pthread_mutex_lock(&(party->spawning));
+	party->philosophers[i].thread_started = 1;
+	party->threads_started++;
+	pthread_mutex_unlock(&(party->spawning));
+	if (pthread_create(&(party->philosophers[i].thread), \
+		&(party->thread_attributes), philosopher_routine, \
+		(void *)&(party->philosophers[i])) != 0)
 	{
+		pthread_mutex_lock(&(party->spawning));
+		party->philosophers[i].thread_started = 0;
+		party->threads_started--;
+		pthread_mutex_unlock(&(party->spawning));
 		printf("Failed to create a philo thread\n");
 		return (THREAD_FAIL);
 	}
@@ -49,8 +129,8 @@ t_return_value	start_philosopher(t_party	*party, unsigned int i)
  */
 t_return_value	start_monitoring(t_party	*party)
 {
-	if (pthread_create(&(party->monitoring_thread), NULL, \
-		monitoring_routine, (void *)party) != 0)
+	if (pthread_create(&(party->monitoring_thread), \
+		&(party->thread_attributes), monitoring_routine, (void *)party) != 0)
 	{
 		printf("Failed to create a monitoring thread\n");
 		return (THREAD_FAIL);
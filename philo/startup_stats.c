@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   startup_stats.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:31:08 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 16:31:08 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+#include <fcntl.h>
+
+/**
+ * @brief Reads the virtual memory size of the process.
+ *
+ * The first field of /proc/self/statm is the total program size in pages. 
+ * Systems without procfs report 0.
+ *
+ * @return long The virtual memory size in KiB, or 0 if unknown.
+ */
+static long	virtual_memory_size(void)
+{
+	char	buffer[64];
+	ssize_t	length;
+	long	pages;
+	int		fd;
+	int		i;
+
+	fd = open("/proc/self/statm", O_RDONLY);
+	if (fd < 0)
+		return (0);
+	length = read(fd, buffer, sizeof(buffer) - 1);
+	close(fd);
+	pages = 0;
+	i = 0;
+	while (i < length && buffer[i] >= '0' && buffer[i] <= '9')
+		pages = pages * 10 + buffer[i++] - '0';
+	return (pages * (sysconf(_SC_PAGESIZE) / 1024));
+}
+
+/**
+ * @brief Reads the proportional set size of a process.
+ *
+ * Each resident page counts for its size divided by the number of processes
+ * mapping it, so the sizes of processes sharing pages add up to the memory
+ * they use together. Systems without /proc/<pid>/smaps_rollup report 0.
+ *
+ * @param pid The process to look at.
+ * @return long The proportional set size in KiB, or 0 if unknown.
+ */
+long	proportional_set_size(pid_t pid)
+{
+	char	buffer[2048];
+	char	*field;
+	ssize_t	length;
+	long	size;
+	int		fd;
+
+	snprintf(buffer, sizeof(buffer), "/proc/%d/smaps_rollup", (int)pid);
+	fd = open(buffer, O_RDONLY);
+	if (fd < 0)
+		return (0);
+	length = read(fd, buffer, sizeof(buffer) - 1);
+	close(fd);
+	if (length <= 0)
+		return (0);
+	buffer[length] = '\0';
+	field = strstr(buffer, "\nPss:");
+	if (field == NULL)
+		return (0);
+	field += 5;
+	while (*field == ' ')
+		field++;
+	size = 0;
+	while (*field >= '0' && *field <= '9')
+		size = size * 10 + *field++ - '0';
+	return (size);
+}
+
+/**
+ * @brief Samples the memory footprint once all philosophers are running.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ */
+void	measure_startup_footprint(t_party *party)
+{
+	struct rusage	usage;
+
+	party->startup_rss = 0;
+	if (getrusage(RUSAGE_SELF, &usage) == 0)
+		party->startup_rss = usage.ru_maxrss;
+	party->startup_vsz = virtual_memory_size();
+	party->startup_pss = proportional_set_size(getpid());
+}
+
+/**
+ * @brief Prints the startup cost of the party to stderr.
+ *
+ * Reports the wall time from the first pthread_create to every philosopher 
+ * running, with the stack size, spawn strategy, peak resident set size, 
+ * virtual size and proportional set size at that point.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ */
+void	report_startup(t_party *party)
+{
+	size_t		stack_size;
+	const char	*strategy;
+
+	strategy = "tree";
+	if (party->options.serial_spawn)
+		strategy = "serial";
+	pthread_attr_getstacksize(&(party->thread_attributes), &stack_size);
+	fprintf(stderr, "startup\tthreads %u\tstack %zu KiB\t%s spawn %.3f ms\t"
+		"peak rss %ld KiB\tvsz %ld KiB\tpss %ld KiB\n",
+		party->number_of_philosophers, stack_size / 1024, strategy,
+		party->spawn_duration / 1000.0, party->startup_rss,
+		party->startup_vsz, party->startup_pss);
+}
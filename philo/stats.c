@@ -0,0 +1,171 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:02:17 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 10:02:17 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Stamps the start of a meal and records the philosopher's slack.
+ *
+ * The slack is how much time the philosopher still had before starving when
+ * they started eating: time_to_die - (now - time_last_ate). The smallest
+ * slack seen is kept in min_slack. Must be called with the philosopher's
+ * meal_update mutex held.
+ *
+ * @param philosopher A pointer to the t_philosopher struct.
+ */
+void	record_meal_start(t_philosopher *philosopher)
+{
+	unsigned long long	now;
+	long long			slack;
+
+	now = get_current_time();
+	slack = (long long)philosopher->party->time_to_die
+		- (long long)(now - philosopher->time_last_ate);
+	if (slack < philosopher->min_slack)
+		philosopher->min_slack = slack;
+	philosopher->time_last_ate = now;
+}
+
+/**
+ * @brief Computes the smallest slack of the table at the end of the party.
+ *
+ * Besides the slack recorded at each meal start, the time each philosopher
+ * has been waiting when the party ended is accounted for, so a starved
+ * philosopher shows up as a negative slack.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return long long The smallest slack in microseconds.
+ */
+static long long	table_min_slack(t_party *party)
+{
+	unsigned int	i;
+	long long		min_slack;
+	long long		final_slack;
+	t_philosopher	*philosopher;
+
+	i = 0;
+	min_slack = (long long)party->time_to_die;
+	while (i < party->number_of_philosophers)
+	{
+		philosopher = &(party->philosophers[i]);
+		pthread_mutex_lock(&(philosopher->meal_update));
+		final_slack = (long long)party->time_to_die
+			- (long long)(party->party_end_time - philosopher->time_last_ate);
+		if (philosopher->min_slack < min_slack)
+			min_slack = philosopher->min_slack;
+		if (final_slack < min_slack)
+			min_slack = final_slack;
+		pthread_mutex_unlock(&(philosopher->meal_update));
+		i++;
+	}
+	return (min_slack);
+}
+
+/**
+ * @brief Sums the meals every philosopher finished by the end of the party.
+ *
+ * meal_count also counts the last meal of a philosopher who was still 
+ * eating when the party ended: `custom_usleep` cuts it short, or it ends 
+ * after party_end_time. Such a meal did not last a full time_to_eat within 
+ * the party, so it is left out, which keeps the rate within its bound.
+ * `report_cpu_statistics` counts the meals the same way.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @return unsigned long long The total count of finished meals.
+ */
+unsigned long long	table_meal_count(t_party *party)
+{
+	unsigned int		i;
+	unsigned long long	meals;
+	t_philosopher		*philosopher;
+
+	i = 0;
+	meals = 0;
+	while (i < party->number_of_philosophers)
+	{
+		philosopher = &(party->philosophers[i]);
+		pthread_mutex_lock(&(philosopher->meal_update));
+		meals += philosopher->meal_count;
+		if (philosopher->meal_count > 0 && philosopher->time_last_ate
+			+ party->time_to_eat > party->party_end_time)
+			meals--;
+		pthread_mutex_unlock(&(philosopher->meal_update));
+		i++;
+	}
+	return (meals);
+}
+
+/**
+ * @brief Gathers the throughput and slack statistics of an ended party.
+ *
+ * Besides the total meal count, the meals per second and the smallest slack, 
+ * it computes the theoretical bound of floor(N / 2) concurrent eaters per 
+ * time_to_eat and, if someone starved, who and when (in ms since the start).
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @param statistics A pointer to the t_philo_statistics struct to fill.
+ */
+void	collect_statistics(t_party *party, t_philo_statistics *statistics)
+{
+	statistics->total_meals = table_meal_count(party);
+	statistics->duration = (party->party_end_time - party->party_start_time)
+		/ 1e6;
+	if (statistics->duration <= 0)
+		statistics->duration = 1e-6;
+	statistics->meals_per_second = statistics->total_meals
+		/ statistics->duration;
+	statistics->meals_per_second_bound = (party->number_of_philosophers / 2)
+		* 1e6 / party->time_to_eat;
+	statistics->min_slack = table_min_slack(party) / 1000.0;
+	statistics->someone_died = (party->outcome == SOMEONE_DIED);
+	statistics->dead_philosopher = 0;
+	statistics->death_time = 0;
+	if (statistics->someone_died == 0)
+		return ;
+	statistics->dead_philosopher = party->dead_philosopher + 1;
+	statistics->death_time = (party->death_time - party->party_start_time)
+		/ 1000ULL;
+}
+
+/**
+ * @brief Prints the throughput and slack statistics of the party.
+ *
+ * When the `--stats` option is set, this function prints the startup cost 
+ * of the party and the statistics gathered by `collect_statistics` to 
+ * stderr, so the event log on stdout stays untouched. If someone died, the 
+ * time the monitor took to notice it past the deadline is printed too. 
+ * `--cpu-stats` adds the CPU accounting of `report_cpu_statistics` and 
+ * `--latency` the wakeup latencies of `report_latency`.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ */
+void	report_statistics(t_party *party)
+{
+	t_philo_statistics	statistics;
+
+	if (party->options.cpu_stats)
+		report_cpu_statistics(party);
+	if (party->options.latency)
+		report_latency(party);
+	if (party->options.stats == 0)
+		return ;
+	report_startup(party);
+	collect_statistics(party, &statistics);
+	fprintf(stderr, "stats\tmeals %llu\tduration %.3f s\tmeals/s %.2f\t"
+		"bound %.2f\tmin slack %.3f ms", statistics.total_meals,
+		statistics.duration, statistics.meals_per_second,
+		statistics.meals_per_second_bound, statistics.min_slack);
+	if (statistics.someone_died)
+		fprintf(stderr, "\tdeath lag %.3f ms",
+			(party->death_time - party->death_deadline) / 1000.0);
+	fprintf(stderr, "\n");
+}
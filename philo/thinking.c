@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   thinking.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:20:48 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 11:20:48 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Reads when a philosopher last started eating.
+ *
+ * @param philosopher A pointer to the t_philosopher struct.
+ * @return unsigned long long The time_last_ate of the philosopher.
+ */
+static unsigned long long	last_meal_of(t_philosopher *philosopher)
+{
+	unsigned long long	time_last_ate;
+
+	pthread_mutex_lock(&(philosopher->meal_update));
+	time_last_ate = philosopher->time_last_ate;
+	pthread_mutex_unlock(&(philosopher->meal_update));
+	return (time_last_ate);
+}
+
+/**
+ * @brief Tells whether one of the philosopher's neighbours is hungrier.
+ *
+ * A neighbour is hungrier when their last meal started before the
+ * philosopher's own, i.e. they are closer to time_to_die.
+ *
+ * @param philosopher A pointer to the t_philosopher struct.
+ * @param own_last_meal The time_last_ate of the philosopher.
+ * @return int 1 if the left or the right neighbour is hungrier, 0 otherwise.
+ */
+static int	neighbour_is_hungrier(t_philosopher *philosopher,
+		unsigned long long own_last_meal)
+{
+	t_party			*party;
+	unsigned int	n;
+
+	party = philosopher->party;
+	n = party->number_of_philosophers;
+	if (last_meal_of(&(party->philosophers[(philosopher->index + n - 1) % n]))
+		< own_last_meal)
+		return (1);
+	return (last_meal_of(&(party->philosophers[(philosopher->index + 1) % n]))
+		< own_last_meal);
+}
+
+/**
+ * @brief Computes the longest a philosopher can afford to think.
+ *
+ * The budget is half of the philosopher's remaining slack: the time they can
+ * still wait before starving, minus one meal spent waiting on a fork held by
+ * a neighbour. Yielding within that budget never puts the thinker at risk.
+ *
+ * @param philosopher A pointer to the t_philosopher struct.
+ * @param own_last_meal The time_last_ate of the philosopher.
+ * @return unsigned long long The think budget in microseconds.
+ */
+static unsigned long long	think_budget(t_philosopher *philosopher,
+		unsigned long long own_last_meal)
+{
+	t_party		*party;
+	long long	slack;
+
+	party = philosopher->party;
+	slack = (long long)party->time_to_die
+		- (long long)(get_current_time() - own_last_meal)
+		- (long long)party->time_to_eat;
+	if (slack <= 0)
+		return (0);
+	return ((unsigned long long)slack / 2);
+}
+
+/**
+ * @brief Thinks for as long as a hungrier neighbour may need the forks.
+ *
+ * Rushing back to the forks right after sleeping lets a philosopher who has
+ * just eaten race a neighbour who is closer to starving, which on odd tables
+ * with time_to_die close to 3 * time_to_eat starves that neighbour. The
+ * philosopher therefore keeps thinking while a neighbour is hungrier than
+ * them, and goes back to the forks as soon as nobody is, so no capacity is
+ * wasted when yielding is pointless. Thinking never lasts longer than
+ * `think_budget`.
+ *
+ * @param philosopher A pointer to the t_philosopher struct.
+ */
+void	think(t_philosopher *philosopher)
+{
+	unsigned long long	own_last_meal;
+	unsigned long long	budget;
+	unsigned long long	start_time;
+
+	own_last_meal = last_meal_of(philosopher);
+	budget = think_budget(philosopher, own_last_meal);
+	start_time = get_current_time();
+	while (get_current_time() - start_time < budget
+		&& neighbour_is_hungrier(philosopher, own_last_meal))
+	{
+		pthread_mutex_lock(&(philosopher->party->dying));
+		if (philosopher->party->someone_dead != 0)
+		{
+			pthread_mutex_unlock(&(philosopher->party->dying));
+			break ;
+		}
+		pthread_mutex_unlock(&(philosopher->party->dying));
+		usleep(THINK_POLL_INTERVAL);
+	}
+}
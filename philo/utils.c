@@ -12,22 +12,63 @@
 
 #include "philosophers.h"
 
-void	print_whats_happening(t_philosopher *philosopher, char *event)
+/**
+ * @brief Reports an event of the party.
+ *
+ * If an event callback was registered through the library API, the event is
+ * handed over to it; otherwise it is printed in the philo log format:
+ * timestamp in ms since the party started, philosopher number on the whole 
+ * table and event.
+ * Must be called with the party's dying mutex held, which serializes the
+ * events of a party.
+ *
+ * @param party A pointer to the t_party struct representing the party data.
+ * @param index The 0-based index of the philosopher concerned.
+ * @param event The type of the event.
+ */
+void	emit_event(t_party *party, unsigned int index, t_philo_event_type event)
 {
-	unsigned long long	timestamp;
+	static const char	*descriptions[] = {"has taken a fork", "is eating",
+		"is sleeping", "is thinking", "died"};
+	t_philo_event		philo_event;
 
+	philo_event.timestamp = (get_current_time() - party->party_start_time)
+		/ 1000ULL;
+	if (party->event_callback == NULL)
+	{
+		printf("%llu\t%u\t%s\n", philo_event.timestamp,
+			party->segment.first_seat + index + 1, descriptions[event]);
+		return ;
+	}
+	philo_event.philosopher = index + 1;
+	philo_event.type = event;
+	philo_event.description = descriptions[event];
+	party->event_callback(&philo_event, party->event_data);
+}
+
+void	print_whats_happening(t_philosopher *philosopher,
+		t_philo_event_type event)
+{
+	t_cpu_phase	phase;
+
+	phase = cpu_phase(&(philosopher->cpu), CPU_LOGGING);
 	pthread_mutex_lock(&(philosopher->party->dying));
-	timestamp = get_current_time() - philosopher->party->party_start_time;
-	timestamp /= 1000ULL;
 	if (philosopher->party->someone_dead == 0)
-		printf("%llu\t%d\t%s\n", timestamp, philosopher->index + 1, event);
+	{
+		emit_event(philosopher->party, philosopher->index, event);
+		note_activity(philosopher, event);
+	}
 	pthread_mutex_unlock(&(philosopher->party->dying));
+	cpu_phase(&(philosopher->cpu), phase);
 }
 
-void	custom_usleep(unsigned long long duration, t_party *party)
+void	custom_usleep(unsigned long long duration, t_philosopher *philosopher)
 {
 	unsigned long long	start_time;
+	t_party				*party;
 
+	party = philosopher->party;
+	duration += jitter_delay(philosopher);
 	start_time = get_current_time();
 	while (get_current_time() - start_time < duration)
 	{
@@ -38,7 +79,7 @@ void	custom_usleep(unsigned long long duration, t_party *party)
 			break ;
 		}
 		pthread_mutex_unlock(&(party->dying));
-		usleep(500);
+		measured_usleep(philosopher->latency, SLEEP_SLICE);
 	}
 }
 
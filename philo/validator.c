@@ -0,0 +1,179 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   validator.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:51:03 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 17:51:03 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "validator.h"
+
+/**
+ * @brief Completes the line left unfinished by the previous read.
+ *
+ * A line split across two reads is gathered in `pending`, which holds at
+ * most VALIDATOR_LINE_MAX bytes; longer lines cannot come from philo and
+ * are checked truncated, so they are reported as malformed.
+ *
+ * @param validator A pointer to the t_validator struct.
+ * @param buffer The bytes just read.
+ * @param length The number of bytes read.
+ * @return size_t The number of bytes of the buffer used by the line.
+ */
+static size_t	finish_pending_line(t_validator *validator, const char *buffer,
+		size_t length)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < length && buffer[i] != '\n')
+	{
+		if (validator->pending_length < VALIDATOR_LINE_MAX - 1)
+			validator->pending[validator->pending_length++] = buffer[i];
+		i++;
+	}
+	if (i == length)
+		return (length);
+	validator->pending[validator->pending_length++] = '\n';
+	validate_line(validator, validator->pending, validator->pending_length);
+	validator->pending_length = 0;
+	return (i + 1);
+}
+
+/**
+ * @brief Checks every complete line of a read and keeps the rest.
+ *
+ * Lines are checked in place in the read buffer; only the unfinished tail
+ * is copied to `pending`.
+ *
+ * @param validator A pointer to the t_validator struct.
+ * @param buffer The bytes just read.
+ * @param length The number of bytes read.
+ */
+static void	validate_buffer(t_validator *validator, const char *buffer,
+		size_t length)
+{
+	size_t		start;
+	const char	*end;
+
+	start = 0;
+	if (validator->pending_length > 0)
+		start = finish_pending_line(validator, buffer, length);
+	while (start < length)
+	{
+		end = memchr(buffer + start, '\n', length - start);
+		if (end == NULL)
+		{
+			finish_pending_line(validator, buffer + start, length - start);
+			return ;
+		}
+		validate_line(validator, buffer + start, end - buffer - start + 1);
+		start = end - buffer + 1;
+	}
+}
+
+/**
+ * @brief Starts checking the next run of a `--repeat K` log.
+ *
+ * Every run starts over at timestamp 0 with the seats reset, so a line 
+ * going back to within ROUND_START_TOLERANCE ms of the start, while fewer 
+ * than K runs were seen, opens the next run: the state of the log is reset 
+ * and the line is checked as the first one of a fresh table. Any other 
+ * timestamp going back is left to `check_event` to report.
+ *
+ * @param validator A pointer to the t_validator struct.
+ * @param timestamp The timestamp of the line, in ms.
+ */
+void	start_next_round(t_validator *validator, unsigned long long timestamp)
+{
+	if (validator->table.options.repeat <= 1
+		|| validator->round + 1 >= validator->table.options.repeat
+		|| timestamp > ROUND_START_TOLERANCE
+		|| timestamp >= validator->last_timestamp[0])
+		return ;
+	validator->round++;
+	memset(validator->last_timestamp, 0, sizeof(validator->last_timestamp));
+	memset(validator->forks_held, 0, sizeof(validator->forks_held));
+	memset(validator->meal_start, 0, sizeof(validator->meal_start));
+	memset(validator->has_eaten, 0, sizeof(validator->has_eaten));
+	validator->died = 0;
+}
+
+/**
+ * @brief Prepares the validator for the table described by the arguments.
+ *
+ * The log of a `--restore` party starts in the middle of the snapshot's 
+ * meals and waits, so it cannot be checked on its own: it is rejected, and 
+ * is checked appended to the log up to the snapshot, without `--restore`.
+ *
+ * @param validator A pointer to the t_validator struct.
+ * @param argc Number of command-line arguments.
+ * @param argv Array of command-line argument strings.
+ * @return t_return_value SUCCESS, the error of `parse_args` or 
+ * CONFLICTING_OPTIONS
+ */
+static t_return_value	init_validator(t_validator *validator, int argc,
+		char **argv)
+{
+	t_return_value	ret_val;
+
+	memset(validator, 0, sizeof(t_validator));
+	ret_val = parse_args(&(validator->table), argc, argv);
+	if (ret_val != SUCCESS)
+		return (ret_val);
+	if (validator->table.options.restore_file != NULL)
+	{
+		printf("A --restore log starts mid-party: validate it after the log "
+			"up to the snapshot, without --restore\n");
+		return (CONFLICTING_OPTIONS);
+	}
+	validator->time_to_die = validator->table.time_to_die / 1000;
+	validator->time_to_eat = validator->table.time_to_eat / 1000;
+	validator->segments = 1;
+	if (validator->table.options.segments > 1)
+		validator->segments = validator->table.options.segments;
+	return (SUCCESS);
+}
+
+/**
+ * @brief Entry point of philo_validator.
+ *
+ * Reads a philo log on stdin and checks the invariants of the simulation
+ * as the log streams in: forks before meals, no neighbours eating together,
+ * monotonic timestamps, nothing after a death and deaths reported within
+ * 10 ms of the deadline. It takes the same arguments as philo, options
+ * included, so that `./philo ARGS | ./philo_validator ARGS` checks a run.
+ * Memory use does not depend on the length of the log.
+ *
+ * @param argc Number of command-line arguments.
+ * @param argv Array of command-line argument strings.
+ * @return int SUCCESS, 1 if an invariant was violated, or an input error.
+ */
+int	main(int argc, char **argv)
+{
+	static t_validator	validator;
+	static char			buffer[VALIDATOR_READ_SIZE];
+	t_return_value		ret_val;
+	ssize_t				bytes;
+
+	ret_val = init_validator(&validator, argc, argv);
+	if (ret_val != SUCCESS)
+		return (ret_val);
+	bytes = read(STDIN_FILENO, buffer, VALIDATOR_READ_SIZE);
+	while (bytes > 0)
+	{
+		validate_buffer(&validator, buffer, bytes);
+		bytes = read(STDIN_FILENO, buffer, VALIDATOR_READ_SIZE);
+	}
+	if (validator.pending_length > 0)
+		validate_buffer(&validator, "\n", 1);
+	fprintf(stderr, "validator\tlines %llu\tviolations %llu\n",
+		validator.line, validator.errors);
+	if (validator.errors > 0)
+		return (1);
+	return (SUCCESS);
+}
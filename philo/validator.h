@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   validator.h                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:46:12 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 17:46:12 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef VALIDATOR_H
+# define VALIDATOR_H
+
+# include "philosophers.h"
+
+/* ************************************************************************** */
+/*   Define Constants														  */
+/* ************************************************************************** */
+# define VALIDATOR_READ_SIZE 65536
+# define VALIDATOR_LINE_MAX 128
+# define VALIDATOR_MAX_REPORTS 20
+# define DEATH_REPORT_TOLERANCE 10
+# define MEAL_OVERLAP_TOLERANCE 1
+# define ROUND_START_TOLERANCE 5
+# define NO_SEAT UINT_MAX
+
+/* ************************************************************************** */
+/*   Struct Definitions														  */
+/* ************************************************************************** */
+
+/*
+ * State of the log read so far. Everything is sized for the largest table,
+ * so the validator runs in constant memory whatever the length of the log.
+ * Times are in milliseconds, like the log. With `--segments`, every segment
+ * writes its own lines to the log, so timestamps only increase within one
+ * segment and last_timestamp is kept per segment. With `--repeat K`, the
+ * log holds K runs in a row and round counts the runs already started.
+ */
+typedef struct s_validator
+{
+	t_party				table;
+	unsigned long long	time_to_die;
+	unsigned long long	time_to_eat;
+	unsigned long long	line;
+	unsigned long long	errors;
+	unsigned int		segments;
+	unsigned int		round;
+	unsigned long long	last_timestamp[MAX_AMOUNT_PHILO_ALLOWED];
+	int					died;
+	unsigned char		forks_held[MAX_AMOUNT_PHILO_ALLOWED];
+	unsigned long long	meal_start[MAX_AMOUNT_PHILO_ALLOWED];
+	unsigned char		has_eaten[MAX_AMOUNT_PHILO_ALLOWED];
+	char				pending[VALIDATOR_LINE_MAX];
+	size_t				pending_length;
+}						t_validator;
+
+/* ************************************************************************** */
+/*   Function Prototypes													  */
+/* ************************************************************************** */
+void					validate_line(t_validator *validator, const char *line,
+							size_t length);
+void					start_next_round(t_validator *validator,
+							unsigned long long timestamp);
+
+#endif
@@ -0,0 +1,171 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   validator_checks.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:58:40 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 17:58:40 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "validator.h"
+
+/**
+ * @brief Reports a violated invariant.
+ *
+ * Every violation is counted; only the first VALIDATOR_MAX_REPORTS are
+ * printed, so a broken run does not flood the terminal.
+ *
+ * @param validator A pointer to the t_validator struct.
+ * @param seat The 0-based seat of the philosopher concerned, or NO_SEAT.
+ * @param problem What is wrong.
+ */
+static void	report_violation(t_validator *validator, unsigned int seat,
+		const char *problem)
+{
+	validator->errors++;
+	if (validator->errors <= VALIDATOR_MAX_REPORTS && seat == NO_SEAT)
+		fprintf(stderr, "line %llu: %s\n", validator->line, problem);
+	else if (validator->errors <= VALIDATOR_MAX_REPORTS)
+		fprintf(stderr, "line %llu: philosopher %u %s\n", validator->line,
+			seat + 1, problem);
+}
+
+/**
+ * @brief Checks the start of a meal.
+ *
+ * The philosopher must hold the two forks announced before, and no
+ * neighbour may still be eating: a meal started at time t lasts until
+ * t + time_to_eat. MEAL_OVERLAP_TOLERANCE ms absorbs the truncation of the
+ * timestamps to whole milliseconds.
+ *
+ * @param validator A pointer to the t_validator struct.
+ * @param seat The 0-based seat of the philosopher.
+ * @param timestamp The timestamp of the line, in ms.
+ */
+static void	check_meal(t_validator *validator, unsigned int seat,
+		unsigned long long timestamp)
+{
+	unsigned int	seats;
+	unsigned int	neighbour;
+	int				side;
+
+	seats = validator->table.number_of_philosophers;
+	if (validator->forks_held[seat] < 2)
+		report_violation(validator, seat, "eats without holding two forks");
+	validator->forks_held[seat] = 0;
+	side = 0;
+	while (seats > 1 && side < 2)
+	{
+		neighbour = (seat + 1) % seats;
+		if (side == 1)
+			neighbour = (seat + seats - 1) % seats;
+		if (validator->has_eaten[neighbour] && timestamp
+			+ MEAL_OVERLAP_TOLERANCE < validator->meal_start[neighbour]
+			+ validator->time_to_eat)
+			report_violation(validator, seat, "eats while a neighbour eats");
+		side++;
+	}
+	validator->meal_start[seat] = timestamp;
+	validator->has_eaten[seat] = 1;
+}
+
+/**
+ * @brief Checks a death against the philosopher's true deadline.
+ *
+ * The deadline is the start of their last meal (or of the party) plus
+ * time_to_die. The death must not be printed before it, nor more than
+ * DEATH_REPORT_TOLERANCE ms after it.
+ *
+ * @param validator A pointer to the t_validator struct.
+ * @param seat The 0-based seat of the philosopher.
+ * @param timestamp The timestamp of the line, in ms.
+ */
+static void	check_death(t_validator *validator, unsigned int seat,
+		unsigned long long timestamp)
+{
+	unsigned long long	deadline;
+
+	deadline = validator->time_to_die;
+	if (validator->has_eaten[seat])
+		deadline += validator->meal_start[seat];
+	if (timestamp < deadline)
+		report_violation(validator, seat, "dies before their deadline");
+	else if (timestamp > deadline + DEATH_REPORT_TOLERANCE)
+		report_violation(validator, seat, "dies more than 10 ms late");
+	validator->died = 1;
+}
+
+/**
+ * @brief Checks one event against the state of the log.
+ *
+ * Seats are split over segments as by `run_segment`: segment s starts at
+ * seat s * N / P.
+ *
+ * @param validator A pointer to the t_validator struct.
+ * @param seat The 0-based seat of the philosopher.
+ * @param timestamp The timestamp of the line, in ms.
+ * @param message The text of the event.
+ */
+static void	check_event(t_validator *validator, unsigned int seat,
+		unsigned long long timestamp, const char *message)
+{
+	unsigned int	segment;
+
+	if (validator->died)
+		report_violation(validator, seat, "is printed after a death");
+	segment = ((seat + 1) * validator->segments - 1)
+		/ validator->table.number_of_philosophers;
+	if (timestamp < validator->last_timestamp[segment])
+		report_violation(validator, seat, "goes back in time");
+	validator->last_timestamp[segment] = timestamp;
+	if (strncmp(message, "has taken a fork\n", 17) == 0)
+	{
+		validator->forks_held[seat]++;
+		if (validator->forks_held[seat] > 2)
+			report_violation(validator, seat, "takes a third fork");
+	}
+	else if (strncmp(message, "is eating\n", 10) == 0)
+		check_meal(validator, seat, timestamp);
+	else if (strncmp(message, "died\n", 5) == 0)
+		check_death(validator, seat, timestamp);
+	else if (strncmp(message, "is sleeping\n", 12) != 0
+		&& strncmp(message, "is thinking\n", 12) != 0)
+		report_violation(validator, seat, "does something unknown");
+}
+
+/**
+ * @brief Parses and checks one line of the log.
+ *
+ * A line is "timestamp\tphilosopher\tevent\n", as printed by philo. Lines
+ * of another shape are reported as malformed. A line may open the next run
+ * of a `--repeat` log, see `start_next_round`.
+ *
+ * @param validator A pointer to the t_validator struct.
+ * @param line The line, ending with '\n'.
+ * @param length The length of the line, '\n' included.
+ */
+void	validate_line(t_validator *validator, const char *line, size_t length)
+{
+	unsigned long long	timestamp;
+	unsigned long long	seat;
+	size_t				i;
+
+	validator->line++;
+	timestamp = 0;
+	seat = 0;
+	i = 0;
+	while (i < length && line[i] >= '0' && line[i] <= '9')
+		timestamp = timestamp * 10 + line[i++] - '0';
+	if (i == 0 || i >= length || line[i++] != '\t')
+		return (report_violation(validator, NO_SEAT, "malformed line"));
+	while (i < length && line[i] >= '0' && line[i] <= '9')
+		seat = seat * 10 + line[i++] - '0';
+	if (i >= length || line[i++] != '\t' || seat == 0
+		|| seat > validator->table.number_of_philosophers)
+		return (report_violation(validator, NO_SEAT, "malformed line"));
+	start_next_round(validator, timestamp);
+	check_event(validator, (unsigned int)seat - 1, timestamp, line + i);
+}
@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wait_cycle.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 23:59:02 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 23:59:02 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Reads the wait-for edge of one philosopher, without recording it.
+ *
+ * @param party A pointer to the t_party struct.
+ * @param seat The index of the philosopher.
+ * @return int The index of the philosopher holding the fork waited for, or
+ * -1 if the philosopher waits for nobody.
+ */
+static int	next_waited(t_party *party, int seat)
+{
+	t_philosopher	*philosopher;
+	t_fork			*fork;
+	t_philosopher	*holder;
+
+	philosopher = &(party->philosophers[seat]);
+	pthread_mutex_lock(&(philosopher->meal_update));
+	fork = philosopher->waiting_for;
+	pthread_mutex_unlock(&(philosopher->meal_update));
+	if (fork == NULL)
+		return (-1);
+	pthread_mutex_lock(&(fork->arbiter));
+	holder = fork->holder;
+	pthread_mutex_unlock(&(fork->arbiter));
+	if (holder == NULL || holder == philosopher)
+		return (-1);
+	return ((int)holder->index);
+}
+
+/**
+ * @brief Publishes a new wait and checks if it closes a wait-for cycle.
+ *
+ * With `--deadlock`, the wait is published with `note_fork_wait`, then the
+ * philosopher follows the chain of waits from the holder of the fork. A
+ * cycle is closed by the last of its waits to start, so the walk that
+ * comes back to the philosopher finds it; the philosopher is then flagged
+ * as a suspect for `detect_deadlock` to confirm. The walk only costs the
+ * length of the chain, and only when a philosopher has to wait. The caller
+ * must hold no lock.
+ *
+ * @param philosopher A pointer to the t_philosopher struct starting to wait.
+ * @param fork The fork waited for.
+ */
+void	start_fork_wait(t_philosopher *philosopher, t_fork *fork)
+{
+	t_party			*party;
+	unsigned int	steps;
+	int				seat;
+
+	party = philosopher->party;
+	if (party->options.deadlock == 0)
+		return ;
+	note_fork_wait(philosopher, fork);
+	seat = next_waited(party, (int)philosopher->index);
+	steps = 0;
+	while (seat >= 0 && seat != (int)philosopher->index
+		&& steps < party->number_of_philosophers)
+	{
+		seat = next_waited(party, seat);
+		steps++;
+	}
+	if (seat != (int)philosopher->index)
+		return ;
+	pthread_mutex_lock(&(party->dying));
+	party->deadlock_suspect = philosopher->index + 1;
+	pthread_mutex_unlock(&(party->dying));
+}
@@ -0,0 +1,183 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wait_graph.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lclerc <lclerc@hive.student.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 18:47:20 by lclerc            #+#    #+#             */
+/*   Updated: 2026/10/19 18:47:20 by lclerc           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @brief Follows the wait-for edge of one philosopher.
+ *
+ * A philosopher blocked on a fork waits for the philosopher holding it. The
+ * start of the wait is kept in wait_snapshot for `cycle_persists`.
+ *
+ * @param party A pointer to the t_party struct.
+ * @param i The index of the philosopher.
+ * @return int The index of the philosopher waited for, or -1 if none.
+ */
+static int	waited_seat(t_party *party, unsigned int i)
+{
+	t_philosopher	*philosopher;
+	t_fork			*fork;
+	t_philosopher	*holder;
+
+	philosopher = &(party->philosophers[i]);
+	pthread_mutex_lock(&(philosopher->meal_update));
+	fork = philosopher->waiting_for;
+	philosopher->wait_snapshot = philosopher->waiting_since;
+	pthread_mutex_unlock(&(philosopher->meal_update));
+	if (fork == NULL)
+		return (-1);
+	pthread_mutex_lock(&(fork->arbiter));
+	holder = fork->holder;
+	pthread_mutex_unlock(&(fork->arbiter));
+	if (holder == NULL || holder == philosopher)
+		return (-1);
+	philosopher->waited_fork = fork - party->forks;
+	return ((int)holder->index);
+}
+
+/**
+ * @brief Follows the waits of a suspect to confirm their cycle.
+ *
+ * The suspect was flagged by `start_fork_wait` from a walk of the graph
+ * that may have read waits that did not overlap. The monitor walks it
+ * again, recording each edge for `cycle_persists` and `report_deadlock`.
+ * The walk costs the length of the cycle, at most N.
+ *
+ * @param party A pointer to the t_party struct.
+ * @param seat The index of the suspect.
+ * @return int 1 if the waits lead back to the suspect, 0 otherwise.
+ */
+static int	confirm_cycle(t_party *party, int seat)
+{
+	unsigned int	steps;
+	int				next;
+
+	steps = 0;
+	next = seat;
+	while (steps < party->number_of_philosophers)
+	{
+		party->philosophers[next].waits_on = waited_seat(party, next);
+		next = party->philosophers[next].waits_on;
+		if (next < 0)
+			return (0);
+		if (next == seat)
+			return (1);
+		steps++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Checks that a cycle is made of the same waits as on the last tick.
+ *
+ * The graph is read one philosopher at a time, so a cycle seen once may be
+ * made of waits that did not overlap. A philosopher of a cycle holds a fork
+ * while waiting, so if every member is still in the same wait one tick
+ * later, none of them let go in between: the deadlock is real.
+ *
+ * @param party A pointer to the t_party struct.
+ * @param seat The index of a philosopher in the cycle.
+ * @return int 1 if every wait of the cycle was already seen, 0 otherwise.
+ */
+static int	cycle_persists(t_party *party, int seat)
+{
+	t_philosopher	*member;
+	int				first;
+	int				persists;
+
+	first = seat;
+	persists = 1;
+	while (1)
+	{
+		member = &(party->philosophers[seat]);
+		if (member->stuck_since != member->wait_snapshot)
+			persists = 0;
+		member->stuck_since = member->wait_snapshot;
+		seat = member->waits_on;
+		if (seat == first)
+			return (persists);
+	}
+}
+
+/**
+ * @brief Prints a deadlock cycle to stderr.
+ *
+ * One line per philosopher of the cycle, with the fork they wait for, its
+ * holder and when the wait started, in ms since the start of the party.
+ *
+ * @param party A pointer to the t_party struct.
+ * @param seat The index of a philosopher in the cycle.
+ */
+static void	report_deadlock(t_party *party, int seat)
+{
+	t_philosopher	*member;
+	unsigned int	first_seat;
+	int				first;
+
+	first_seat = party->segment.first_seat;
+	first = seat;
+	fprintf(stderr, "deadlock\t%llu ms\n", (get_current_time()
+			- party->party_start_time) / 1000ULL);
+	while (1)
+	{
+		member = &(party->philosophers[seat]);
+		fprintf(stderr, "deadlock\tphilosopher %u\twaits for fork %u\t"
+			"held by philosopher %u\tsince %llu ms\n", first_seat + seat + 1,
+			first_seat + member->waited_fork + 1, first_seat
+			+ member->waits_on + 1, (member->stuck_since
+				- party->party_start_time) / 1000ULL);
+		seat = member->waits_on;
+		if (seat == first)
+			return ;
+	}
+}
+
+/**
+ * @brief Ends the party if its philosophers are deadlocked.
+ *
+ * Called by the monitor on every tick with `--deadlock`. A deadlock is a
+ * cycle of philosophers, each holding a fork and waiting for the next one's,
+ * which would otherwise only show time_to_die later as a death. The graph
+ * is kept up to date by the philosophers as they start waiting, see
+ * `start_fork_wait`, so a tick without a suspect costs a single lock; a
+ * suspect's cycle is confirmed with `confirm_cycle` and must persist over
+ * two ticks. A suspect whose waits no longer form a cycle is cleared.
+ *
+ * @param party A pointer to the t_party struct.
+ * @return t_return_value DEADLOCKED or LIFE_GOES_ON
+ */
+t_return_value	detect_deadlock(t_party *party)
+{
+	int	seat;
+
+	pthread_mutex_lock(&(party->dying));
+	seat = (int)party->deadlock_suspect - 1;
+	pthread_mutex_unlock(&(party->dying));
+	if (seat < 0)
+		return (LIFE_GOES_ON);
+	if (confirm_cycle(party, seat) == 0)
+	{
+		pthread_mutex_lock(&(party->dying));
+		if (party->deadlock_suspect == (unsigned int)seat + 1)
+			party->deadlock_suspect = 0;
+		pthread_mutex_unlock(&(party->dying));
+		return (LIFE_GOES_ON);
+	}
+	if (cycle_persists(party, seat) == 0)
+		return (LIFE_GOES_ON);
+	pthread_mutex_lock(&(party->dying));
+	party->outcome = DEADLOCKED;
+	party->someone_dead = 1;
+	pthread_mutex_unlock(&(party->dying));
+	report_deadlock(party, seat);
+	return (DEADLOCKED);
+}